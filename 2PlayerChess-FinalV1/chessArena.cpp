@@ -0,0 +1,62 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessArena.cpp
+ *      Purpose: Bump allocator for per-game and per-search data, released by mark or all at once.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: Throws bad_alloc if a block cannot be allocated.
+ *
+ */
+
+#include "chessArena.h"
+#include <new>
+
+chessArena::chessArena() {
+}
+
+chessArena::~chessArena(){
+    for(size_t i = 0; i < blocks.size(); i++){
+        delete[] blocks.at(i);
+    }
+}
+
+void* chessArena::allocate(size_t bytes, size_t alignment){
+    for(;;){
+        if(current < blocks.size()){
+            // align the address, not just the offset, since blocks only come aligned for the basic types
+            size_t address = reinterpret_cast<size_t>(blocks[current]) + used;
+            size_t start = used + ((alignment - address % alignment) % alignment);
+            if(start + bytes <= blockSizes[current]){
+                used = start + bytes;
+                return blocks[current] + start;
+            }
+            if(current + 1 < blocks.size() && blockSizes[current + 1] >= bytes + alignment){
+                current++;
+                used = 0;
+                continue;
+            }
+        }
+        // no kept block fits: add one after the current block, so later blocks stay in use order
+        size_t size = (bytes + alignment > blockSize) ? bytes + alignment : blockSize;
+        size_t index = (current < blocks.size()) ? current + 1 : blocks.size();
+        blocks.insert(blocks.begin() + index, new char[size]);
+        blockSizes.insert(blockSizes.begin() + index, size);
+        current = index;
+        used = 0;
+    }
+}
+
+arenaMark chessArena::mark(){
+    return {current, used};
+}
+
+void chessArena::release(arenaMark m){
+    current = m.block;
+    used = m.used;
+}
+
+void chessArena::reset(){
+    current = 0;
+    used = 0;
+}
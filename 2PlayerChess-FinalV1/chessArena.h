@@ -0,0 +1,92 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessArena.h
+ *      Purpose: Bump allocator for short lived data that belongs to one game or one search, such as move
+ *               lists and sort keys.  Allocating is a pointer increment inside large blocks that are kept
+ *               for reuse, and everything allocated is given back at once: to a saved mark when a scope
+ *               ends, or entirely with reset().  After the first search has grown the blocks, searching does
+ *               not call malloc at all.  An arena belongs to one thread.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: Throws bad_alloc, like operator new, if a block cannot be allocated.
+ *
+ */
+
+#ifndef CHESSARENA_H
+#define CHESSARENA_H
+#include <cstdlib>
+#include <cstddef>
+#include <vector>
+
+using namespace std;
+
+    struct arenaMark {size_t block; size_t used;};
+    // A saved allocation position of an arena: the block in use and the bytes used in it.
+
+class chessArena {
+public:
+    chessArena();
+    // Purpose: Default constructor. No memory is allocated until the first allocate().
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessSearch;
+    //
+    ~chessArena();
+    // Purpose: Frees every block.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  None;
+    //
+    chessArena(const chessArena&) = delete;
+    chessArena& operator=(const chessArena&) = delete;
+    // An arena owns its blocks, so it cannot be copied: both copies would free them.
+    void* allocate(size_t, size_t);
+    // Purpose: Hands out uninitialised memory from the current block, moving on to the next block when it is full.
+    // Input:   size_t bytes - Size of the allocation.
+    //          size_t alignment - Required alignment, a power of two.
+    // Output:  void* memory - The memory, valid until the arena is released past it or reset.
+    // Caller:  chessArena::allocateArray();
+    //
+    template<class T> T* allocateArray(size_t count){
+        return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+    }
+    // Purpose: Hands out uninitialised memory for an array of trivially copyable objects.
+    // Input:   size_t count - Number of objects.
+    // Output:  T* array - The array.
+    // Caller:  chessMovePicker::generate();
+    //
+    arenaMark mark();
+    // Purpose: Saves the allocation position, to give back everything allocated after it with release().
+    // Input:   None.
+    // Output:  arenaMark mark - The position.
+    // Caller:  chessSearch::alphaBeta(); chessSearch::quiescence();
+    //
+    void release(arenaMark);
+    // Purpose: Gives back everything allocated since a mark. The blocks are kept for reuse.
+    // Input:   arenaMark mark - A position returned by mark() on this arena.
+    // Output:  None.
+    // Caller:  chessSearch::alphaBeta(); chessSearch::quiescence();
+    //
+    void reset();
+    // Purpose: Gives back everything allocated, in constant time. The blocks are kept for reuse.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessSearch::search();
+    //
+    
+private:
+    static const size_t blockSize = 64 * 1024;
+    // Size of a normal block. Larger allocations get a block of their own size.
+    
+    vector<char*> blocks;
+    // Every block allocated, in the order they are used.
+    vector<size_t> blockSizes;
+    // Size of each block.
+    size_t current = 0;
+    // Index of the block allocations come from.
+    size_t used = 0;
+    // Bytes used in the current block.
+};
+
+#endif /* CHESSARENA_H */
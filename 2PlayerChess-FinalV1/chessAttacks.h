@@ -0,0 +1,64 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessAttacks.h
+ *      Purpose: Attack tables of the leaping pieces, the knight and king, and of the pawn captures of each color.
+ *               The tables are built by constexpr functions, so they are generated entirely by the compiler and
+ *               cost nothing at startup.  For every square they hold the squares attacked from it, in a fixed
+ *               order, and the same set as a 64 bit mask with bit x*8+y standing for square x,y.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ *
+ */
+
+#ifndef CHESSATTACKS_H
+#define CHESSATTACKS_H
+#include <cstdlib>
+#include <cstdint>
+#include "globals.h"
+
+using namespace std;
+
+    struct attackTable {int count[64]; coordinates targets[64][8]; uint64_t mask[64];};
+    // The squares attacked from each square of the board, by square index x*8+y. Only the first count entries
+    // of targets are used.
+
+namespace chessAttacks {
+
+    // builds the table of a piece that moves by the given steps, skipping steps that leave the board
+    constexpr attackTable buildTable(const int (&steps)[8][2], int stepCount){
+        attackTable table{};
+        for(int square = 0; square < 64; square++){
+            for(int i = 0; i < stepCount; i++){
+                int x = square / 8 + steps[i][0];
+                int y = square % 8 + steps[i][1];
+                if(x >= 0 && x < 8 && y >= 0 && y < 8){
+                    table.targets[square][table.count[square]] = {x, y};
+                    table.count[square]++;
+                    table.mask[square] |= uint64_t(1) << (x * 8 + y);
+                }
+            }
+        }
+        return table;
+    }
+
+    // steps in the order the move generators have always listed their moves
+    constexpr int knightSteps[8][2] = {{2,1}, {1,2}, {-1,2}, {-2,1}, {1,-2}, {2,-1}, {-2,-1}, {-1,-2}};
+    constexpr int kingSteps[8][2] = {{1,1}, {-1,1}, {1,-1}, {-1,-1}, {1,0}, {-1,0}, {0,1}, {0,-1}};
+    // pawns capture diagonally forward, towards row 0 for WHITE and row 7 for BLACK
+    constexpr int pawnSteps[2][8][2] = {{{-1,-1}, {-1,1}}, {{1,-1}, {1,1}}};
+
+    constexpr attackTable knight = buildTable(knightSteps, 8);
+    // Squares a knight attacks.
+    constexpr attackTable king = buildTable(kingSteps, 8);
+    // Squares a king attacks, without castling.
+    constexpr attackTable pawn[2] = {buildTable(pawnSteps[WHITE], 2), buildTable(pawnSteps[BLACK], 2)};
+    // Squares a pawn of each color attacks, indexed by color.
+
+    static_assert(knight.count[0] == 2 && knight.count[27] == 8, "knight table");
+    static_assert(king.count[63] == 3 && king.mask[0] == 0x302, "king table");
+    static_assert(pawn[WHITE].count[8] == 1 && pawn[BLACK].targets[0][0].posX == 1, "pawn table");
+}
+
+#endif /* CHESSATTACKS_H */
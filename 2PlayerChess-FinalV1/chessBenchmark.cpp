@@ -0,0 +1,310 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessBenchmark.cpp
+ *      Purpose: Microbenchmarks for the hot primitives of the rules engine, built as its own executable by the
+ *               Benchmark configuration ("make benchmark" or "make CONF=Benchmark").  Every primitive runs over
+ *               the same fixed set of positions, from the opening through the endgame, and is timed in repeated
+ *               samples so the spread between runs is visible next to the average cost.
+ *      Input: Optional command line arguments: --samples <count>, and a name filter that selects the benchmarks
+ *             whose name contains it.
+ *      Output: One line per benchmark on standard output: mean, standard deviation and best ns/op over all samples.
+ *      Exceptions: None.
+ *
+ */
+
+#include <cstdlib>
+#include <cstdint>
+#include <cmath>
+#include <cstdio>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+#include "globals.h"
+#include "chessTile.h"
+#include "chessPiece.h"
+#include "chessLogic.h"
+#include "chessNotation.h"
+
+using namespace std;
+
+namespace {
+
+    // A position to benchmark on, with its own board and rules object.
+    struct benchPosition {
+        const char* name;
+        chessTile board[8][8];
+        color sideToMove;
+        color inCheck;
+        boardRights rights;
+        chessLogic logic;
+        vector<coordinates> pieces[6];
+        // squares of every piece on the board, by piece type
+        vector<chessMove> moves;
+        // moves of the side to move that follow the piece rules, legal or not
+    };
+
+    // The positions, in FEN notation.
+    const char* positionFens[][2] = {
+        {"start", "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -"},
+        {"italian", "r1bqk2r/pppp1ppp/2n2n2/2b1p3/2B1P3/2N2N2/PPPP1PPP/R1BQK2R w KQkq -"},
+        {"queens gambit", "r1bq1rk1/pp2bppp/2n1pn2/2pp4/3P1B2/2P1PN2/PP1N1PPP/R2QKB1R w KQ -"},
+        {"tactical", "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -"},
+        {"heavy pieces", "2rq1rk1/5ppp/p3p3/1p1n4/3P4/P2Q1N2/1P3PPP/2R2RK1 b - -"},
+        {"rook ending", "8/5pk1/6p1/8/3R4/6P1/5PK1/3r4 w - -"},
+        {"queen ending", "6k1/5ppp/8/8/8/8/q4PPP/3Q2K1 b - -"},
+        {"mated", "rnb1kbnr/pppp1ppp/8/4p3/6Pq/5P2/PPPPP2P/RNBQKBNR w KQkq -"}
+    };
+    const int positionCount = sizeof(positionFens) / sizeof(positionFens[0]);
+
+    benchPosition positions[positionCount];
+    volatile uint64_t benchSink;
+    // results are folded into benchSink so the compiler cannot drop the work being timed
+
+    // loads the FEN position, then caches piece squares and candidate moves
+    void setupPosition(benchPosition* pos, const char* name, const char* fen){
+        pos->name = name;
+        chessNotation::parseFen(fen, &pos->board, &pos->sideToMove, &pos->rights);
+        pos->inCheck = NONE;
+        pos->logic = chessLogic(&pos->board, &pos->sideToMove, &pos->inCheck, &pos->rights);
+
+        vector<coordinates> targets;
+        for(int i = 0; i < 8; i++){
+            for(int j = 0; j < 8; j++){
+                pieceData piece = pos->board[i][j].getActivePiece();
+                if(piece.pieceType == NOPIECE){
+                    continue;
+                }
+                pos->pieces[piece.pieceType].push_back({i,j});
+                if(piece.pieceColor != pos->sideToMove){
+                    continue;
+                }
+                targets.clear();
+                switch(piece.pieceType){
+                    case PAWN:
+                        pos->logic.queryValidPawnMoves({i,j}, piece.pieceColor, &targets);
+                        break;
+                    case ROOK:
+                        pos->logic.queryValidRookMoves({i,j}, piece.pieceColor, &targets);
+                        break;
+                    case KNIGHT:
+                        pos->logic.queryValidKnightMoves({i,j}, piece.pieceColor, &targets);
+                        break;
+                    case BISHOP:
+                        pos->logic.queryValidBishopMoves({i,j}, piece.pieceColor, &targets);
+                        break;
+                    case QUEEN:
+                        pos->logic.queryValidRookMoves({i,j}, piece.pieceColor, &targets);
+                        pos->logic.queryValidBishopMoves({i,j}, piece.pieceColor, &targets);
+                        break;
+                    case KING:
+                        pos->logic.queryValidKingMoves({i,j}, piece.pieceColor, &targets);
+                        break;
+                    default:
+                        break;
+                }
+                for(int m = 0; m < targets.size(); m++){
+                    pos->moves.push_back({{i,j}, targets.at(m), NOPIECE});
+                }
+            }
+        }
+    }
+
+    // one full pass of a benchmark over every position. Returns the number of operations performed.
+    typedef function<uint64_t()> benchPass;
+
+    struct benchmark {
+        const char* name;
+        benchPass pass;
+    };
+
+    uint64_t passTileQueries(bool activePiece){
+        uint64_t ops = 0, sum = 0;
+        for(int p = 0; p < positionCount; p++){
+            for(int i = 0; i < 8; i++){
+                for(int j = 0; j < 8; j++){
+                    if(activePiece){
+                        sum += positions[p].board[i][j].getActivePiece().pieceType;
+                    }
+                    else{
+                        sum += positions[p].board[i][j].getControllingPlayer();
+                    }
+                }
+            }
+            ops += 64;
+        }
+        benchSink += sum;
+        return ops;
+    }
+
+    uint64_t passPieceQueries(chessPieceType type){
+        static vector<coordinates> moves;
+        uint64_t ops = 0, sum = 0;
+        for(int p = 0; p < positionCount; p++){
+            benchPosition& pos = positions[p];
+            for(int s = 0; s < pos.pieces[type].size(); s++){
+                coordinates from = pos.pieces[type].at(s);
+                color c = pos.board[from.posX][from.posY].getControllingPlayer();
+                moves.clear();
+                switch(type){
+                    case PAWN:
+                        pos.logic.queryValidPawnMoves(from, c, &moves);
+                        break;
+                    case ROOK:
+                        pos.logic.queryValidRookMoves(from, c, &moves);
+                        break;
+                    case KNIGHT:
+                        pos.logic.queryValidKnightMoves(from, c, &moves);
+                        break;
+                    case BISHOP:
+                        pos.logic.queryValidBishopMoves(from, c, &moves);
+                        break;
+                    case QUEEN:
+                        // a queen moves as a rook and a bishop, as queryValidQueenMoves() generates them
+                        pos.logic.queryValidRookMoves(from, c, &moves);
+                        pos.logic.queryValidBishopMoves(from, c, &moves);
+                        break;
+                    case KING:
+                        pos.logic.queryValidKingMoves(from, c, &moves);
+                        break;
+                    default:
+                        break;
+                }
+                sum += moves.size();
+                ops++;
+            }
+        }
+        benchSink += sum;
+        return ops;
+    }
+
+    uint64_t passAllMoves(){
+        for(int p = 0; p < positionCount; p++){
+            positions[p].logic.queryAllMovesByColor(positions[p].sideToMove);
+        }
+        return positionCount;
+    }
+
+    uint64_t passInCheck(){
+        uint64_t sum = 0;
+        for(int p = 0; p < positionCount; p++){
+            sum += positions[p].logic.isPlayerInCheck(positions[p].sideToMove);
+        }
+        benchSink += sum;
+        return positionCount;
+    }
+
+    uint64_t passMoveCheck(){
+        uint64_t ops = 0, sum = 0;
+        for(int p = 0; p < positionCount; p++){
+            benchPosition& pos = positions[p];
+            for(int m = 0; m < pos.moves.size(); m++){
+                sum += pos.logic.isMoveCheckForKing(pos.moves.at(m).from, pos.moves.at(m).to, pos.sideToMove);
+            }
+            ops += pos.moves.size();
+        }
+        benchSink += sum;
+        return ops;
+    }
+
+    uint64_t passOutOfMoves(){
+        uint64_t sum = 0;
+        for(int p = 0; p < positionCount; p++){
+            sum += positions[p].logic.isPlayerOutOfMoves(positions[p].sideToMove);
+        }
+        benchSink += sum;
+        return positionCount;
+    }
+
+    // times a benchmark in a number of samples of at least minSampleTime each, and prints its ns/op statistics
+    void runBenchmark(const benchmark& bench, int samples){
+        const chrono::nanoseconds minSampleTime = chrono::milliseconds(20);
+
+        // warm up, and find how many passes fill one sample
+        uint64_t passes = 1;
+        for(;;){
+            auto start = chrono::steady_clock::now();
+            for(uint64_t i = 0; i < passes; i++){
+                bench.pass();
+            }
+            if(chrono::steady_clock::now() - start >= minSampleTime / 4){
+                break;
+            }
+            passes *= 2;
+        }
+        passes *= 4;
+
+        vector<double> nsPerOp;
+        for(int s = 0; s < samples; s++){
+            uint64_t ops = 0;
+            auto start = chrono::steady_clock::now();
+            for(uint64_t i = 0; i < passes; i++){
+                ops += bench.pass();
+            }
+            auto elapsed = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start);
+            nsPerOp.push_back(double(elapsed.count()) / double(ops));
+        }
+
+        double mean = 0, variance = 0, best = nsPerOp.at(0);
+        for(int s = 0; s < samples; s++){
+            mean += nsPerOp.at(s);
+            best = (nsPerOp.at(s) < best) ? nsPerOp.at(s) : best;
+        }
+        mean /= samples;
+        for(int s = 0; s < samples; s++){
+            variance += (nsPerOp.at(s) - mean) * (nsPerOp.at(s) - mean);
+        }
+        variance = (samples > 1) ? variance / (samples - 1) : 0;
+        printf("%-32s %12.2f %10.2f %6.1f%% %12.2f\n", bench.name, mean, sqrt(variance),
+               (mean > 0) ? 100.0 * sqrt(variance) / mean : 0.0, best);
+        fflush(stdout);
+    }
+}
+
+/*
+ * Runs every benchmark whose name matches the filter, or all of them.
+ */
+int main(int argc, char** argv) {
+
+    int samples = 10;
+    string filter;
+    for(int i = 1; i < argc; i++){
+        string arg = argv[i];
+        if(arg == "--samples" && i + 1 < argc){
+            samples = atoi(argv[++i]);
+            samples = (samples < 1) ? 1 : samples;
+        }
+        else{
+            filter = arg;
+        }
+    }
+
+    for(int p = 0; p < positionCount; p++){
+        setupPosition(&positions[p], positionFens[p][0], positionFens[p][1]);
+    }
+
+    benchmark benchmarks[] = {
+        {"chessTile::getActivePiece", [](){ return passTileQueries(true); }},
+        {"chessTile::getControllingPlayer", [](){ return passTileQueries(false); }},
+        {"queryValidPawnMoves", [](){ return passPieceQueries(PAWN); }},
+        {"queryValidRookMoves", [](){ return passPieceQueries(ROOK); }},
+        {"queryValidKnightMoves", [](){ return passPieceQueries(KNIGHT); }},
+        {"queryValidBishopMoves", [](){ return passPieceQueries(BISHOP); }},
+        {"queryValidQueenMoves", [](){ return passPieceQueries(QUEEN); }},
+        {"queryValidKingMoves", [](){ return passPieceQueries(KING); }},
+        {"queryAllMovesByColor", passAllMoves},
+        {"isPlayerInCheck", passInCheck},
+        {"isMoveCheckForKing", passMoveCheck},
+        {"isPlayerOutOfMoves", passOutOfMoves}
+    };
+
+    printf("%d positions, %d samples per benchmark\n", positionCount, samples);
+    printf("%-32s %12s %10s %7s %12s\n", "benchmark", "ns/op", "stddev", "cv", "best ns/op");
+    for(const benchmark& bench : benchmarks){
+        if(filter.empty() || string(bench.name).find(filter) != string::npos){
+            runBenchmark(bench, samples);
+        }
+    }
+    return 0;
+}
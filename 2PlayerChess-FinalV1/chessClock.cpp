@@ -0,0 +1,85 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessClock.cpp
+ *      Purpose: Chess clock with a base time and increment for both players.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ *
+ */
+
+#include "chessClock.h"
+
+chessClock::chessClock() {
+}
+
+void chessClock::setTimeControl(int base, int inc){
+    baseTime = (base > 0) ? base : 0;
+    increment = (inc > 0) ? inc : 0;
+    reset();
+}
+
+void chessClock::reset(){
+    remaining[WHITE] = remaining[BLACK] = baseTime;
+    running = NONE;
+}
+
+bool chessClock::isEnabled(){
+    return baseTime > 0;
+}
+
+void chessClock::start(color side){
+    running = side;
+    turnStart = chrono::steady_clock::now();
+}
+
+bool chessClock::stop(){
+    color side = running;
+    if(!pause()){
+        return false;
+    }
+    if(side != NONE){
+        remaining[side] += increment;
+    }
+    return true;
+}
+
+bool chessClock::pause(){
+    if(running == NONE){
+        return true;
+    }
+    int64_t elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - turnStart).count();
+    int64_t& left = remaining[running];
+    running = NONE;
+    if(elapsed >= left){
+        left = 0;
+        return false;
+    }
+    left -= elapsed;
+    return true;
+}
+
+int chessClock::getRemaining(color side){
+    int64_t left = remaining[side];
+    if(side == running){
+        left -= chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - turnStart).count();
+    }
+    return (left > 0) ? int(left) : 0;
+}
+
+int chessClock::getIncrement(){
+    return increment;
+}
+
+int chessClock::getBaseTime(){
+    return baseTime;
+}
+
+void chessClock::setRemaining(color side, int left){
+    remaining[side] = (left > 0) ? left : 0;
+}
+
+bool chessClock::hasFlagged(){
+    return running != NONE && getRemaining(running) == 0;
+}
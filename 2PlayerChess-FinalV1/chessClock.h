@@ -0,0 +1,112 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessClock.h
+ *      Purpose: Chess clock for both players: a base time plus an increment added after every move.  Only the
+ *               side to move has its clock running; stopping it charges the time taken and adds the increment.
+ *      Input: The time control, see setTimeControl(), and the start and end of every turn.
+ *      Output: The time left for each side, and whether the running side has run out of time.
+ *      Exceptions: None.
+ *
+ */
+
+#ifndef CHESSCLOCK_H
+#define CHESSCLOCK_H
+#include <cstdlib>
+#include <cstdint>
+#include <chrono>
+#include "globals.h"
+
+using namespace std;
+
+class chessClock {
+public:
+    chessClock();
+    // Purpose: Default constructor. The clock is disabled until a time control is set.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame;
+    //
+    void setTimeControl(int, int);
+    // Purpose: Sets the time control of the games started afterwards.
+    // Input:   int baseTime - Milliseconds each side starts with, 0 to play without a clock.
+    //          int increment - Milliseconds added to a side's time after each of its moves.
+    // Output:  None.
+    // Caller:  chessGame::setClock();
+    //
+    void reset();
+    // Purpose: Stops the clock and gives both sides the base time again, for a new game.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::startNewGame();
+    //
+    bool isEnabled();
+    // Purpose: Checks whether games are played with a clock.
+    // Input:   None.
+    // Output:  Returns TRUE if a base time is set.
+    // Caller:  chessGame;
+    //
+    void start(color);
+    // Purpose: Starts the clock of the side to move.
+    // Input:   color side - The side to move.
+    // Output:  None.
+    // Caller:  chessGame::startTurn();
+    //
+    bool stop();
+    // Purpose: Stops the running clock once its side has moved, charging the time taken and adding the increment.
+    // Input:   None.
+    // Output:  Returns FALSE if the side ran out of time before it moved; its time is then left at 0.
+    // Caller:  chessGame::submitMove();
+    //
+    bool pause();
+    // Purpose: Stops the running clock without a move, charging the time taken but adding no increment.
+    // Input:   None.
+    // Output:  Returns FALSE if the side ran out of time; its time is then left at 0.
+    // Caller:  chessClock::stop(); chessGame::handleInput();
+    //
+    int getRemaining(color);
+    // Purpose: Returns the time a side has left, counting its turn so far if its clock is running.
+    // Input:   color side - The side.
+    // Output:  int remaining - Milliseconds, never below 0.
+    // Caller:  chessGame;
+    //
+    int getIncrement();
+    // Purpose: Returns the increment of the time control.
+    // Input:   None.
+    // Output:  int increment - Milliseconds added after each move.
+    // Caller:  chessGame::playEngineMove(); chessGame::saveSnapshot();
+    //
+    int getBaseTime();
+    // Purpose: Returns the base time of the time control.
+    // Input:   None.
+    // Output:  int baseTime - Milliseconds each side starts with, 0 without a clock.
+    // Caller:  chessGame::saveSnapshot();
+    //
+    void setRemaining(color, int);
+    // Purpose: Sets the time a side has left, for a game resumed part way through.
+    // Input:   color side - The side.
+    //          int remaining - Milliseconds left, not counting a running turn.
+    // Output:  None.
+    // Caller:  chessGame::loadSnapshot();
+    //
+    bool hasFlagged();
+    // Purpose: Checks whether the side whose clock is running has run out of time.
+    // Input:   None.
+    // Output:  Returns TRUE once its time is used up.
+    // Caller:  chessGame::loopGameplay();
+    //
+
+private:
+    int baseTime = 0;
+    // Milliseconds each side starts with, 0 for no clock.
+    int increment = 0;
+    // Milliseconds added after each move.
+    int64_t remaining[2] = {};
+    // Milliseconds left for WHITE and BLACK, not counting the running turn.
+    color running = NONE;
+    // The side whose clock is running, NONE if stopped.
+    chrono::steady_clock::time_point turnStart;
+    // When the running clock was started.
+};
+
+#endif /* CHESSCLOCK_H */
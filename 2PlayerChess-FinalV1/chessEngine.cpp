@@ -0,0 +1,119 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessEngine.cpp
+ *      Purpose: Computer opponent with pondering for interactive games.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ *
+ */
+
+#include "chessEngine.h"
+#include "chessGame.h"
+#include "chessStats.h"
+
+namespace {
+    const int stopPollInterval = 1;
+    // milliseconds abandonSearch() waits between requests to stop the running search
+}
+
+chessEngine::chessEngine(searchLimits limits, bool ponder) {
+    moveLimits = limits;
+    isPonderEnabled = ponder;
+    worker = thread(&chessEngine::searchLoop, this);
+}
+
+chessEngine::~chessEngine(){
+    {
+        unique_lock<mutex> guard(lock);
+        abandonSearch(guard);
+        isQuitting = true;
+    }
+    wakeUp.notify_all();
+    worker.join();
+}
+
+chessMove chessEngine::chooseMove(chessGame* game, int remaining, int increment){
+    unique_lock<mutex> guard(lock);
+    bool isPonderHit = false;
+    if(isPondering){
+        isPondering = false;
+        isPonderHit = (game->getPositionHash() == ponderHash);
+        chessStats::increment(isPonderHit ? PONDER_HITS : PONDER_MISSES);
+    }
+
+    // the timer is started before pondering is turned off, which hands its limits to the search thread
+    if(remaining >= 0){
+        timer.start(remaining, increment);
+    }
+    if(isPonderHit){
+        // the pondering search is already on this position, so it carries on under the move's limits
+        search.setPondering(false);
+    }
+    else{
+        abandonSearch(guard);
+        game->setupSearch(&search);
+        isTimed = (remaining >= 0);
+        search.setTimeManager(isTimed ? &timer : NULL);
+        search.setPondering(false);
+        isPending = true;
+        wakeUp.notify_all();
+    }
+    wakeUp.wait(guard, [this]{ return hasResult; });
+    return lastResult.bestMove;
+}
+
+void chessEngine::startPondering(chessGame* game){
+    unique_lock<mutex> guard(lock);
+    if(!isPonderEnabled || !hasResult || lastResult.ponderMove.from.posX < 0){
+        return;
+    }
+
+    // chooseMove() left the thread idle, so the search can be set up right away
+    game->setupSearch(&search);
+    ponderHash = search.playRootMove(lastResult.ponderMove);
+    search.setPondering(true);
+    isPondering = true;
+    hasResult = false;
+    isPending = true;
+    guard.unlock();
+    wakeUp.notify_all();
+}
+
+void chessEngine::stopPondering(){
+    unique_lock<mutex> guard(lock);
+    if(isPondering){
+        abandonSearch(guard);
+    }
+}
+
+void chessEngine::searchLoop(){
+    unique_lock<mutex> guard(lock);
+    for(;;){
+        wakeUp.wait(guard, [this]{ return isPending || isQuitting; });
+        if(isQuitting){
+            return;
+        }
+        isPending = false;
+        isSearching = true;
+        guard.unlock();
+        searchResult result = search.search(moveLimits);
+        guard.lock();
+        isSearching = false;
+        lastResult = result;
+        hasResult = true;
+        wakeUp.notify_all();
+    }
+}
+
+void chessEngine::abandonSearch(unique_lock<mutex>& guard){
+    // a stop can be missed while the thread is just starting a search, so it is asked again until the search returns
+    isPending = false;
+    isPondering = false;
+    while(isSearching){
+        search.stop();
+        wakeUp.wait_for(guard, chrono::milliseconds(stopPollInterval));
+    }
+    hasResult = false;
+}
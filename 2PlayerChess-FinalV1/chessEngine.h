@@ -0,0 +1,118 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessEngine.h
+ *      Purpose: Computer opponent for one side of an interactive game.  Its searches run on a thread of its own,
+ *               and after each of its moves it ponders: it searches the position after the reply it expects
+ *               while the player is thinking.  If the player makes that reply the running search simply goes on
+ *               with its real limits, keeping everything it has searched so far; any other move abandons it.
+ *               On a clock each move's search is timed by a chessTimeManager, started when the engine's turn
+ *               comes, so time spent pondering on a correct guess is free.
+ *      Input: The game to play in, the limits of each search and the engine's time left.
+ *      Output: The engine's moves, see chooseMove().
+ *      Exceptions: None.
+ *
+ */
+
+#ifndef CHESSENGINE_H
+#define CHESSENGINE_H
+#include <cstdlib>
+#include <cstdint>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "globals.h"
+#include "chessSearch.h"
+#include "chessTimeManager.h"
+
+using namespace std;
+
+class chessGame;
+
+class chessEngine {
+public:
+    chessEngine(searchLimits, bool);
+    // Purpose: Starts the search thread, idle until the engine is asked for a move.
+    // Input:   searchLimits limits - Depth and node limits of each move's search.
+    //          bool isPonderEnabled - TRUE to search on the player's time.
+    // Output:  None.
+    // Caller:  chessGame::loopGameplay();
+    //
+    ~chessEngine();
+    // Purpose: Abandons any search and joins the thread.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  None;
+    //
+    chessMove chooseMove(chessGame*, int, int);
+    // Purpose: Finds the engine's move in the game's current position, waiting for the search to finish.  On a
+    //          ponder hit this only waits for the pondering search to use up its limits.
+    // Input:   chessGame* game - The game, with the engine to move. Only read.
+    //          int remaining - Milliseconds left on the engine's clock, -1 if the game has no clock.  A clock
+    //                          at 0 still gets the first iteration, so the search never runs unbounded.
+    //          int increment - Milliseconds the clock adds after the move.
+    // Output:  chessMove move - The move to play, from.posX -1 if there is no legal move.
+    // Caller:  chessGame::playEngineMove();
+    //
+    void startPondering(chessGame*);
+    // Purpose: Starts searching the position after the reply expected to the engine's last move, in the
+    //          background.  Does nothing if pondering is off or no reply was predicted.
+    // Input:   chessGame* game - The game, just after the engine's move. Only read during the call.
+    // Output:  None.
+    // Caller:  chessGame::playEngineMove();
+    //
+    void stopPondering();
+    // Purpose: Abandons the pondering search once the game has left the line it was started on.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::handleInput();
+    //
+
+private:
+    void searchLoop();
+    // Purpose: Body of the search thread: waits for a position, searches it, hands the result over, and repeats.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessEngine::chessEngine();
+    //
+    void abandonSearch(unique_lock<mutex>&);
+    // Purpose: Stops a pending or running search and waits until the thread is idle, forgetting its result.
+    // Input:   unique_lock<mutex>& guard - Holds lock, released while waiting.
+    // Output:  None.
+    // Caller:  chessEngine::~chessEngine(); chessEngine::chooseMove(); chessEngine::stopPondering();
+    //
+
+    chessSearch search;
+    // The engine's search, run by the search thread. Its position is only set while it is not searching.
+    searchLimits moveLimits;
+    // Depth and node limits of each move's search.
+    chessTimeManager timer;
+    // Budget of the move being searched when playing on a clock. Only started while the search ignores it.
+    bool isTimed = false;
+    // Whether the last move was searched on a clock, so pondering for the next one is timed as well.
+    bool isPonderEnabled;
+    // Whether the engine searches on the player's time.
+    thread worker;
+    // The search thread.
+    mutex lock;
+    // Guards every member below.
+    condition_variable wakeUp;
+    // Signals the thread that there is a position to search, or that it has to quit, and the game that a
+    // search has finished.
+    bool isPending = false;
+    // Set when a position waits to be searched.
+    bool isSearching = false;
+    // Set while the thread is inside search().
+    bool isQuitting = false;
+    // Set by the destructor.
+    bool hasResult = false;
+    // Set once the last search has finished and lastResult holds its outcome.
+    bool isPondering = false;
+    // Set while the pending or running search ponders on the expected reply.
+    uint64_t ponderHash = 0;
+    // Hash of the position being pondered on.
+    searchResult lastResult = {};
+    // Outcome of the last search, including the reply it expects.
+};
+
+#endif /* CHESSENGINE_H */
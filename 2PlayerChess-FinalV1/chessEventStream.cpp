@@ -0,0 +1,172 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessEventStream.cpp
+ *      Purpose: Structured game events as JSON lines or binary records.
+ *      Input: None.
+ *      Output: The event stream.
+ *      Exceptions: None.
+ *
+ */
+
+#include "chessEventStream.h"
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include "chessNotation.h"
+
+namespace {
+
+    const char* eventNames[] = {"move", "capture", "check", "checkmate", "stalemate", "draw", "timeout", "error", "takeback"};
+    // JSON names of the event types, in gameEventType order
+    const char* pieceNames[] = {"pawn", "rook", "knight", "bishop", "queen", "king"};
+    // JSON names of the piece types, in chessPieceType order
+
+    const uint8_t noSquare = 0xFF;
+    // square number of a binary record without that square
+
+    // appends text as a JSON string, escaping quotes, backslashes and control characters
+    void appendJsonString(string* out, const string& text){
+        *out += '"';
+        for(size_t i = 0; i < text.size(); i++){
+            char c = text[i];
+            if(c == '"' || c == '\\'){
+                *out += '\\';
+                *out += c;
+            }
+            else if(uint8_t(c) < 0x20){
+                char escape[8];
+                snprintf(escape, sizeof(escape), "\\u%04x", c);
+                *out += escape;
+            }
+            else{
+                *out += c;
+            }
+        }
+        *out += '"';
+    }
+
+    // appends ,"key":"e4" for a square given as coordinates
+    void appendSquare(string* out, const char* key, coordinates square){
+        char name[2];
+        chessNotation::writeSquare(square, name);
+        *out += ",\"";
+        *out += key;
+        *out += "\":\"";
+        out->append(name, 2);
+        *out += '"';
+    }
+}
+
+chessEventStream::chessEventStream() {
+    buffer.reserve(256);
+}
+
+chessEventStream::~chessEventStream(){
+    if(ownsFd){
+        close(fd);
+    }
+}
+
+bool chessEventStream::open(string target, eventFormat encoding){
+    if(ownsFd){
+        close(fd);
+    }
+    format = encoding;
+    sequence = 0;
+    
+    // a reader closing its end of a pipe must not end the program along with the stream
+    signal(SIGPIPE, SIG_IGN);
+
+    // a plain number names a descriptor the caller has already opened
+    if(!target.empty() && target.find_first_not_of("0123456789") == string::npos){
+        fd = atoi(target.c_str());
+        ownsFd = false;
+        return fcntl(fd, F_GETFD) != -1;
+    }
+    fd = ::open(target.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    ownsFd = (fd >= 0);
+    return fd >= 0;
+}
+
+void chessEventStream::writeMove(color player, chessMove move, chessPieceType piece){
+    writeEvent(EVENT_MOVE, player, move.from, move.to, piece, move.promotion, string());
+}
+
+void chessEventStream::writeCapture(color player, chessPieceType piece, chessPieceType captured, coordinates square){
+    writeEvent(EVENT_CAPTURE, player, {-1, -1}, square, piece, captured, string());
+}
+
+void chessEventStream::writeStatus(gameEventType type, color player, const string& text){
+    writeEvent(type, player, {-1, -1}, {-1, -1}, NOPIECE, NOPIECE, text);
+}
+
+void chessEventStream::writeEvent(gameEventType type, color player, coordinates from, coordinates to, chessPieceType piece, chessPieceType other, const string& text){
+    if(fd < 0){
+        return;
+    }
+    buffer.clear();
+
+    if(format == EVENTS_BINARY){
+        uint16_t length = 10 + text.size();
+        uint8_t fields[6] = {uint8_t(type), uint8_t(player), 0, 0, uint8_t(piece), uint8_t(other)};
+        fields[2] = (from.posX >= 0) ? from.posX * 8 + from.posY : noSquare;
+        fields[3] = (to.posX >= 0) ? to.posX * 8 + to.posY : noSquare;
+        buffer.append(reinterpret_cast<const char*>(&length), sizeof(length));
+        buffer.append(reinterpret_cast<const char*>(fields), 2);
+        buffer.append(reinterpret_cast<const char*>(&sequence), sizeof(sequence));
+        buffer.append(reinterpret_cast<const char*>(fields + 2), 4);
+        buffer += text;
+    }
+    else{
+        buffer += "{\"seq\":";
+        buffer += to_string(sequence);
+        buffer += ",\"event\":\"";
+        buffer += eventNames[type];
+        buffer += "\",\"player\":\"";
+        buffer += (player == WHITE) ? "white" : "black";
+        buffer += '"';
+        if(piece != NOPIECE){
+            buffer += ",\"piece\":\"";
+            buffer += pieceNames[piece];
+            buffer += '"';
+        }
+        if(type == EVENT_MOVE){
+            appendSquare(&buffer, "from", from);
+            appendSquare(&buffer, "to", to);
+            if(other != NOPIECE){
+                buffer += ",\"promotion\":\"";
+                buffer += pieceNames[other];
+                buffer += '"';
+            }
+        }
+        else if(type == EVENT_CAPTURE){
+            buffer += ",\"captured\":\"";
+            buffer += pieceNames[other];
+            buffer += '"';
+            appendSquare(&buffer, "square", to);
+        }
+        if(!text.empty()){
+            buffer += ",\"text\":";
+            appendJsonString(&buffer, text);
+        }
+        buffer += "}\n";
+    }
+    sequence++;
+
+    const char* data = buffer.data();
+    size_t remaining = buffer.size();
+    while(remaining > 0){
+        ssize_t written = write(fd, data, remaining);
+        if(written < 0 && errno == EINTR){
+            continue;
+        }
+        if(written <= 0){
+            break;
+        }
+        data += written;
+        remaining -= written;
+    }
+}
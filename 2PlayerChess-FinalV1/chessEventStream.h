@@ -0,0 +1,113 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessEventStream.h
+ *      Purpose: Writes what happens in a game as structured events to a file descriptor, for programs that follow
+ *               games without reading the board drawn by chessInterface.  Each event is written with a single
+ *               write call, either as one line of JSON or as a length-prefixed binary record:
+ *                   uint16 length      bytes after this field, 10 plus the text
+ *                   uint8  type        gameEventType
+ *                   uint8  player      color of the player the event is about
+ *                   uint32 sequence    number of the event in the stream, from 0
+ *                   uint8  from, to    squares of a move, or the square of a capture in to; 0xFF if none.
+ *                                      Squares are numbered 0 = a8 to 63 = h1, row by row like the board.
+ *                   uint8  piece       piece moved or capturing, NOPIECE if none
+ *                   uint8  other       piece promoted to or captured, NOPIECE if none
+ *                   char   text[]      reason of a draw or error message, not NUL terminated
+ *               in native byte order, like the position index and game snapshots.
+ *      Input: Events reported by chessGame.
+ *      Output: The event stream.
+ *      Exceptions: Write errors are ignored, so a reader going away never stops a game.
+ *
+ */
+
+#ifndef CHESSEVENTSTREAM_H
+#define CHESSEVENTSTREAM_H
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+#include "globals.h"
+
+using namespace std;
+
+    enum eventFormat{EVENTS_JSON, EVENTS_BINARY};
+    // Encoding of a stream: JSON lines, or length-prefixed binary records.
+    enum gameEventType{EVENT_MOVE, EVENT_CAPTURE, EVENT_CHECK, EVENT_CHECKMATE, EVENT_STALEMATE, EVENT_DRAW,
+                       EVENT_TIMEOUT, EVENT_ERROR, EVENT_TAKEBACK};
+    // Kinds of event. The player of a move or capture is the one making it, of a check or checkmate the one in
+    // check, of a stalemate, draw or timeout the one to move, of an error the one whose move was rejected, and
+    // of a takeback the one whose move was taken back.  Each move taken back is one takeback event.
+
+class chessEventStream {
+public:
+    chessEventStream();
+    // Purpose: Default constructor. Events are dropped until open() succeeds.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  main();
+    //
+    ~chessEventStream();
+    // Purpose: Closes the file opened by open(), if any. File descriptors passed by number are left open.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  None;
+    //
+    bool open(string, eventFormat);
+    // Purpose: Sets where the events go.
+    // Input:   string target - A file descriptor number, such as "3" for one set up by the calling shell, or
+    //          the path of a file to append to.
+    //          eventFormat format - Encoding of the events.
+    // Output:  Returns FALSE if the file could not be opened.
+    // Caller:  main();
+    //
+    void writeMove(color, chessMove, chessPieceType);
+    // Purpose: Reports a move, before any capture, check or end of game it leads to.
+    // Input:   color player - The player moving.
+    //          chessMove move - The move, with its promotion piece.
+    //          chessPieceType piece - The piece moved.
+    // Output:  None.
+    // Caller:  chessGame::doMove();
+    //
+    void writeCapture(color, chessPieceType, chessPieceType, coordinates);
+    // Purpose: Reports a capture made by the move just reported.
+    // Input:   color player - The player capturing.
+    //          chessPieceType piece - The capturing piece.
+    //          chessPieceType captured - The piece taken.
+    //          coordinates square - Where the piece was taken, which differs from the move's destination en passant.
+    // Output:  None.
+    // Caller:  chessGame::doMove();
+    //
+    void writeStatus(gameEventType, color, const string&);
+    // Purpose: Reports a check, the end of the game, a rejected move or a move taken back.
+    // Input:   gameEventType type - EVENT_CHECK or a later type.
+    //          color player - The player the event is about, see gameEventType.
+    //          const string& text - Reason of a draw or error message, empty for none.
+    // Output:  None.
+    // Caller:  chessGame;
+    //
+
+private:
+    void writeEvent(gameEventType, color, coordinates, coordinates, chessPieceType, chessPieceType, const string&);
+    // Purpose: Encodes one event in the stream's format and writes it.
+    // Input:   gameEventType type - Kind of event.
+    //          color player - The player the event is about.
+    //          coordinates from, to - Squares of the event, -1,-1 if none.
+    //          chessPieceType piece, other - Pieces of the event, NOPIECE if none.
+    //          const string& text - Text of the event, empty for none.
+    // Output:  None.
+    // Caller:  chessEventStream;
+    //
+
+    int fd = -1;
+    // File descriptor the events are written to, -1 if none.
+    bool ownsFd = false;
+    // Set if fd was opened by open() and is closed with the stream.
+    eventFormat format = EVENTS_JSON;
+    // Encoding of the events.
+    uint32_t sequence = 0;
+    // Number of the next event.
+    string buffer;
+    // The event being encoded, reused between events.
+};
+
+#endif /* CHESSEVENTSTREAM_H */
@@ -1,382 +1,1053 @@
-/*      Author: Drew Tibbetts
- *      Creation Date: 6/22/2019
- *      Modification: 8/6/2019
- *      FileName: chessGame.cpp
- *      Purpose: Contains method initialization for chessGame class.  Manages the entire 2-Player Chess Game
- *      Input: Receives string input from users through getNotationInput() method.
- *      Output: Void. When class methods resolve game returns to main menu.
- *      Exceptions: Input validation is handled through getNotationInput().
- * 
- */
-
-#include "chessGame.h"
-
-
-
-chessGame::chessGame() {
-}
-
-void chessGame::startNewGame(){
-    
-    setupChessBoard();
-    
-    // setup pointer references for chess board to external classes
-    
-    cinterface = chessInterface(&chessBoard, &activeGameState, &activePlayer, &playerInCheck);
-    clogic = chessLogic(&chessBoard, &activePlayer, &playerInCheck);
-    
-     // reset the game board and draw to screen
-    lastMove = " ";
-    gameAction = "New Game Started. White Moves First.";
-    activeGameState = NORMALPLAY;
-    playerInCheck = NONE;
-    updateGameState();
-    
-    // start the main gameplay loop
-    loopGameplay();
-}
-
-void chessGame::setupChessBoard(){
-    
-    // Spawn White Pieces
-    spawnPiece(ROOK, WHITE, {7,0});
-    spawnPiece(KNIGHT, WHITE, {7,1});
-    spawnPiece(BISHOP, WHITE, {7,2});
-    spawnPiece(QUEEN, WHITE, {7,3});
-    spawnPiece(KING, WHITE, {7,4});
-    spawnPiece(BISHOP, WHITE, {7,5});
-    spawnPiece(KNIGHT, WHITE, {7,6});
-    spawnPiece(ROOK, WHITE, {7,7});
-    for (int i = 0; i < 8; i++){
-        spawnPiece(PAWN, WHITE, {6, i});
-    }
-    
-    // Spawn Black Pieces
-    spawnPiece(ROOK, BLACK, {0,0});
-    spawnPiece(KNIGHT, BLACK, {0,1});
-    spawnPiece(BISHOP, BLACK, {0,2});
-    spawnPiece(QUEEN, BLACK, {0,3});
-    spawnPiece(KING, BLACK, {0,4});
-    spawnPiece(BISHOP, BLACK, {0,5});
-    spawnPiece(KNIGHT, BLACK, {0,6});
-    spawnPiece(ROOK, BLACK, {0,7});
-    for (int i = 0; i < 8; i++){
-        spawnPiece(PAWN, BLACK, {1, i});
-    }
-    
-    // Spawn Empty Pieces in rows 3-6 // MAKE SURE the i < 6 not i < 7 when NOT testing
-    for (int i = 2; i < 6; i++){
-        for(int j = 0; j < 8; j++){
-            chessTile newTile;
-            chessBoard[i][j] = newTile;
-        }
-    }
-}
-
-void chessGame::spawnPiece(chessPieceType p, color c, coordinates coords){
-    chessPiece newPiece = chessPiece(p,c);
-    chessTile newTile(newPiece);
-    chessBoard[coords.posX][coords.posY] = newTile;
-    
-}
-
-void chessGame::updateGameState(){
-    
-    // update relevant game information and draw game board
-    cinterface.setPlayerTurn();
-    cinterface.setGameStatus();
-    cinterface.setLastAction(gameAction);
-}
-
-coordinates chessGame::getNotationInput(){
-    bool isValid = false;
-    coordinates coords;
-    string input;
-    
-    while(!isValid){
-        getline(cin, input);
-        coords = validateCoordinates(input);
-        if(coords.posX >= 0 || coords.posY >= 0){
-            lastMove += input.substr(0,2);
-            isValid = true;
-        }
-        else{
-            cout << "Please enter valid input in form of chess notation. (A-H)(1-8): " << endl;
-            isValid = false;
-        }
-    }
-    
-    return coords;
-}
-
-coordinates chessGame::validateCoordinates(string s){
-    
-    coordinates coords;
-    
-    // convert string input input coordinates
-    // get horizontal coordinate
-    switch(s[0]){
-        case 'A':
-        case 'a':
-            coords.posY = 0;
-            break;
-        case 'B':
-        case 'b':
-            coords.posY = 1;
-            break;
-        case 'C':
-        case 'c':
-            coords.posY = 2;
-            break;
-        case 'D':
-        case 'd':
-            coords.posY = 3;
-            break;
-        case 'E':
-        case 'e':
-            coords.posY = 4;
-            break;
-        case 'F':
-        case 'f':
-            coords.posY = 5;
-            break;
-        case 'G':
-        case 'g':
-            coords.posY = 6;
-            break;
-        case 'H':
-        case 'h':
-            coords.posY = 7;
-            break;
-        default:
-            coords.posY = -1;
-            break;
-    }
-
-    // get vertical coordinate
-    switch(s[1]){
-        case '1':
-            coords.posX = 7;
-            break;
-        case '2':
-            coords.posX = 6;
-            break;
-        case '3':
-            coords.posX = 5;
-            break;
-        case '4':
-            coords.posX = 4;
-            break;
-        case '5':
-            coords.posX = 3;
-            break;
-        case '6':
-            coords.posX = 2;
-            break;
-        case '7':
-            coords.posX = 1;
-            break;
-        case '8':
-            coords.posX = 0;
-            break;
-        default:
-            coords.posX = -1;
-            break;
-    }
-    
-    
-    return coords;
-}
-
-bool chessGame::isValidMove(){
-    bool isValid = false;
-    
-    if(!clogic.isValidPiece(moveFrom)){
-        cinterface.setErrorMessasge("Invalid starting coordinates. Cannot move an empty space!");
-        activeGameState = ERROR;
-    }
-    else if(!clogic.isPlayerPiece(moveFrom, activePlayer)){
-        cinterface.setErrorMessasge("Invalid starting coordinates. Cannot move your opponent's piece!");
-        activeGameState = ERROR;
-    }
-    else if(clogic.isPlayerDestination(moveTo, activePlayer)){
-        cinterface.setErrorMessasge("Invalid ending coordinates. Cannot move your piece on top of your other piece!");
-        activeGameState = ERROR;
-    }
-    else if(!clogic.isValidPieceMove(moveFrom, moveTo)){
-        cinterface.setErrorMessasge("DESTINATION coordinates is invalid for this piece, or blocked by another piece.");
-        activeGameState = ERROR;
-    }
-    else if(clogic.isMoveCheckForKing(moveFrom, moveTo, activePlayer)){
-        cinterface.setErrorMessasge("Invalid move.  Cannot put your own king in check!");
-        activeGameState = ERROR;
-    } 
-    else{
-        isValid = true;
-        activeGameState = NORMALPLAY;
-    }
-    
-    
-    return isValid;
-}
-
-void chessGame::loopGameplay(){
-    do {
-        
-        bool isValid = false;
-        
-        /* Print User Instructions */
-        
-        // check if the results in a stalemate before any action
-        if(clogic.isPlayerOutOfMoves(WHITE)){
-            activeGameState = STALEMATE;
-            return;
-        }
-        if (clogic.isPlayerOutOfMoves(BLACK)){
-            activeGameState = STALEMATE;
-            return;
-        }
-        
-        
-        string playerColor;
-        while(!isValid){
-            
-            // draw visual chess board on screen
-            // cout << string(50, '\n');
-            cinterface.drawChessBoard();
-            cinterface.print("    |||--------------|||");
-            cinterface.print("    ||| " + (playerColor = (activePlayer == WHITE) ? "WHITE" : "BLACK") + "'S TURN |||");
-            cinterface.print("    |||--------------|||");
-            // get user input
-            lastMove.clear();
-            cinterface.print(">>> Please enter the STARTING coordinates in Standard Notation (A1, B2, etc): ");
-            moveFrom = getNotationInput();
-            cinterface.print(">>> Please enter the DESTINATION coordinates in Standard Notation (A1, B2, etc): ");
-            moveTo = getNotationInput();
-            
-            if(isValidMove()){
-                isValid = true;
-            }
-        }
-        
-        // if the move is legal and valid, perform the move
-        activeGameState = NORMALPLAY;
-        gameAction = lastMove.substr(0,2) + " to " + lastMove.substr(2,2) + ". "; // updates the output display of last move
-        doMove(moveFrom, moveTo);
-        
-        
-        
-        // check if either player is in check
-        if(clogic.isPlayerInCheck(WHITE)){
-            playerInCheck = WHITE;
-            activeGameState = CHECK;
-        }
-        else if(clogic.isPlayerInCheck(BLACK)){
-            playerInCheck = BLACK;
-            activeGameState = CHECK;
-        }
-        else{
-            playerInCheck = NONE;
-        }
-        
-        // if check is active, check for checkmate
-        if(activeGameState == CHECK){
-            if(clogic.isPlayerOutOfMoves(playerInCheck)){
-              activeGameState = CHECKMATE;
-            }
-        }
-        
-        
-        
-        
-        
-        
-        // after turn is complete, change to opposing color's turn
-        if(activePlayer == WHITE){
-            activePlayer = BLACK;
-        }
-        else {
-            activePlayer = WHITE;
-        }
-        
-        
-        // update game and draw board once ready
-        updateGameState();   
-    }  while (activeGameState != CHECKMATE  && activeGameState != STALEMATE); 
-    
-    return;
-}
-
-void chessGame::capturePiece(chessPieceType attackingPiece, chessPieceType capturedPiece, color c){
-    string str;
-    chessPieceType pieceEval = attackingPiece;
-    str += (c == WHITE) ? "WHITE " : "BLACK ";
-    
-    for(int i = 0; i < 2; i++){
-        switch(pieceEval){
-            case PAWN: 
-                str += "PAWN";
-                break;
-            case ROOK:
-                str += "ROOK";
-                break;
-            case KNIGHT:
-                str += "KNIGHT";
-                break;
-            case BISHOP:
-                str += "BISHOP";
-                break;
-            case QUEEN:
-                str += "QUEEN";
-                break;
-            case KING:
-                str += "KING";
-                break;
-        }
-        
-        if(i == 0){
-            str += " CAPTURES ";
-            str += (c == WHITE) ? "BLACK " : "WHITE ";
-            pieceEval = capturedPiece;
-        }
-        else{
-            str += ".";
-        } 
-    }
-    
-    gameAction += str;
-}
-
-void chessGame::doMove(coordinates from, coordinates to){ 
-    bool flagCapture; 
-    chessTile* startTile = &chessBoard[from.posX][from.posY];
-    chessTile* endTile = &chessBoard[to.posX][to.posY];
-    
-    // check if the player will capture an enemy piece
-    if(endTile->getActivePiece().pieceIcon != ' '){
-        chessPieceType attackingPiece, capturedPiece;
-        attackingPiece = startTile->getActivePiece().pieceType;
-        capturedPiece = endTile->getActivePiece().pieceType;
-        capturePiece(attackingPiece, capturedPiece, activePlayer);
-    }
-    
-    // move the starting tile to the destination, and nullify the origin after
-    *endTile = *startTile;
-    (*startTile).emptyTile();
-}
-
-void chessGame::endGame(){
-    switch(activeGameState){
-        case CHECKMATE:
-            gameAction += (playerInCheck == WHITE) ? "CHECKMATE ON WHITE. BLACK WINS!!" : "CHECKMATE ON BLACK. WHITE WINS!!";
-            break;
-        case STALEMATE:
-            gameAction += "STALEMATE. GAME IS A DRAW.";
-            break;    
-    }
-    
-    updateGameState();
-    cinterface.drawChessBoard();
-    cout << "Game is over. Returning to main menu..." << endl;
-    return;
+/*      Author: Drew Tibbetts
+ *      Creation Date: 6/22/2019
+ *      Modification: 10/19/2026
+ *      FileName: chessGame.cpp
+ *      Purpose: Contains method initialization for chessGame class.  Manages the entire 2-Player Chess Game
+ *      Input: Receives string input from users through handleInput() one line at a time.
+ *      Output: Void. When class methods resolve game returns to main menu.
+ *      Exceptions: Input validation is handled through readNotationInput().
+ * 
+ */
+
+#include "chessGame.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include "chessHash.h"
+#include "chessInput.h"
+#include "chessStats.h"
+#include "chessThreadPool.h"
+#include "chessTrace.h"
+
+namespace {
+    const int idlePollInterval = 50;
+    // milliseconds loopGameplay() waits for input before running the idle task, and between looks at the clock
+    
+    string formatClock(int milliseconds){
+        char text[16];
+        snprintf(text, sizeof(text), "%d:%02d.%d", milliseconds / 60000, milliseconds / 1000 % 60, milliseconds / 100 % 10);
+        return text;
+    }
+    // Purpose: Writes a time left on the clock as minutes, seconds and tenths, e.g. "4:59.8".
+    // Input:   int milliseconds - The time.
+    // Output:  string text - The time as shown to the players.
+    // Caller:  chessGame::promptMoveStart();
+    
+    const uint32_t snapshotVersion = 3;
+    // version of the snapshot layout, raised whenever it changes. Version 2 adds the move log, version 1
+    // snapshots are still read and their log starts at the position they resume. Version 3 adds the clock and
+    // engine settings, older snapshots resume as a game between two players without a clock.
+    
+    // fixed part of a game snapshot, written as is in native byte order like the position index. Each board
+    // square holds the piece type plus 8 times its color, or 0xFF when empty.
+    struct snapshotHeader {
+        char magic[4];
+        uint32_t version;
+        uint8_t board[64];
+        uint8_t activePlayer, playerInCheck, gameState, inputStep;
+        int8_t moveFromX, moveFromY, enPassantX, enPassantY;
+        uint8_t castling, reserved;
+        uint16_t halfmoveClock;
+        uint16_t actionLength, lastMoveLength;
+    };
+    
+    // clock and engine settings, saved after the move log. The time left is what each side had when saving.
+    struct snapshotSettings {
+        int32_t baseTime, increment;
+        int32_t remaining[2];
+        uint8_t engineSide, isPondering, reserved[2];
+        int32_t engineDepth;
+        uint64_t engineNodes;
+    };
+    
+    // checks that saved coordinates name a square on the board
+    bool isSquare(int8_t x, int8_t y){
+        return x >= 0 && x < 8 && y >= 0 && y < 8;
+    }
+}
+
+
+
+chessGame::chessGame() {
+}
+
+void chessGame::startNewGame(){
+    
+    resetGame();
+    updateGameState();
+    chessStats::reset();
+    gameClock.reset();
+    
+    // start the main gameplay loop
+    startTurn();
+    loopGameplay();
+}
+
+void chessGame::resumeGame(){
+    
+    updateGameState();
+    
+    // a game saved while waiting for the destination square continues there, with the player's clock running
+    if(inputStep == AWAIT_DESTINATION){
+        if(gameClock.isEnabled()){
+            gameClock.start(activePlayer);
+        }
+        cinterface.drawChessBoard();
+        cinterface.print(">>> Please enter the DESTINATION coordinates in Standard Notation (A1, B2, etc): ");
+    }
+    else if(!isGameOver()){
+        startTurn();
+    }
+    loopGameplay();
+}
+
+void chessGame::resetGame(){
+    
+    setupChessBoard();
+    
+    // setup pointer references for chess board to external classes
+    
+    cinterface = chessInterface(&chessBoard, &activeGameState, &activePlayer, &playerInCheck);
+    clogic = chessLogic(&chessBoard, &activePlayer, &playerInCheck, &positionRights);
+    cnotation = chessNotation(&chessBoard, &activePlayer, &clogic);
+    
+     // reset the game state
+    lastMove = " ";
+    gameAction = "New Game Started. White Moves First.";
+    activeGameState = NORMALPLAY;
+    activePlayer = WHITE;
+    playerInCheck = NONE;
+    positionRights = {WHITE_KINGSIDE | WHITE_QUEENSIDE | BLACK_KINGSIDE | BLACK_QUEENSIDE, {-1, -1}, 0};
+    history.clear();
+    history.push(getPositionHash(), positionRights.halfmoveClock);
+    startMoveLog();
+}
+
+void chessGame::setupChessBoard(){
+    
+    // Spawn White Pieces
+    spawnPiece(ROOK, WHITE, {7,0});
+    spawnPiece(KNIGHT, WHITE, {7,1});
+    spawnPiece(BISHOP, WHITE, {7,2});
+    spawnPiece(QUEEN, WHITE, {7,3});
+    spawnPiece(KING, WHITE, {7,4});
+    spawnPiece(BISHOP, WHITE, {7,5});
+    spawnPiece(KNIGHT, WHITE, {7,6});
+    spawnPiece(ROOK, WHITE, {7,7});
+    for (int i = 0; i < 8; i++){
+        spawnPiece(PAWN, WHITE, {6, i});
+    }
+    
+    // Spawn Black Pieces
+    spawnPiece(ROOK, BLACK, {0,0});
+    spawnPiece(KNIGHT, BLACK, {0,1});
+    spawnPiece(BISHOP, BLACK, {0,2});
+    spawnPiece(QUEEN, BLACK, {0,3});
+    spawnPiece(KING, BLACK, {0,4});
+    spawnPiece(BISHOP, BLACK, {0,5});
+    spawnPiece(KNIGHT, BLACK, {0,6});
+    spawnPiece(ROOK, BLACK, {0,7});
+    for (int i = 0; i < 8; i++){
+        spawnPiece(PAWN, BLACK, {1, i});
+    }
+    
+    // Spawn Empty Pieces in rows 3-6 // MAKE SURE the i < 6 not i < 7 when NOT testing
+    for (int i = 2; i < 6; i++){
+        for(int j = 0; j < 8; j++){
+            chessTile newTile;
+            chessBoard[i][j] = newTile;
+        }
+    }
+}
+
+void chessGame::spawnPiece(chessPieceType p, color c, coordinates coords){
+    chessPiece newPiece = chessPiece(p,c);
+    chessTile newTile(newPiece);
+    chessBoard[coords.posX][coords.posY] = newTile;
+    
+}
+
+void chessGame::updateGameState(){
+    
+    // update relevant game information and draw game board
+    cinterface.setPlayerTurn();
+    cinterface.setGameStatus();
+    cinterface.setLastAction(gameAction);
+}
+
+bool chessGame::readNotationInput(string input, coordinates* coords){
+    
+    *coords = validateCoordinates(input);
+    if(coords->posX >= 0 && coords->posY >= 0){
+        lastMove += input.substr(0,2);
+        return true;
+    }
+    cinterface.print("Please enter valid input in form of chess notation. (A-H)(1-8): ");
+    return false;
+}
+
+coordinates chessGame::validateCoordinates(string s){
+    
+    coordinates coords = {-1, -1};
+    
+    // convert the first two characters of the input into coordinates, -1,-1 if they are not a square
+    chessNotation::parseSquare(string_view(s).substr(0,2), &coords);
+    return coords;
+}
+
+bool chessGame::readMoveInput(string input){
+    CHESS_TRACE_SPAN("readMoveInput");
+    chessMove move;
+    
+    if(!cnotation.parseMove(input, &move)){
+        // coordinates are often typed in upper case, e.g. "B2B4", which would read as a bishop move in SAN
+        char lower[16];
+        size_t length = (input.size() < sizeof(lower)) ? input.size() : sizeof(lower);
+        for(size_t i = 0; i < length; i++){
+            lower[i] = (input[i] >= 'A' && input[i] <= 'H') ? input[i] - 'A' + 'a' : input[i];
+        }
+        if(!cnotation.parseMove(string_view(lower, length), &move)){
+            return false;
+        }
+    }
+    
+    moveFrom = move.from;
+    moveTo = move.to;
+    movePromotion = move.promotion;
+    
+    // record the move as squares, like a move entered in two steps
+    char squares[4];
+    chessNotation::writeSquare(moveFrom, squares);
+    chessNotation::writeSquare(moveTo, squares + 2);
+    lastMove.assign(squares, 4);
+    return true;
+}
+
+bool chessGame::isValidMove(){
+    CHESS_TRACE_SPAN("isValidMove");
+    bool isValid = false;
+    
+    if(!clogic.isValidPiece(moveFrom)){
+        cinterface.setErrorMessasge("Invalid starting coordinates. Cannot move an empty space!");
+        activeGameState = ERROR;
+    }
+    else if(!clogic.isPlayerPiece(moveFrom, activePlayer)){
+        cinterface.setErrorMessasge("Invalid starting coordinates. Cannot move your opponent's piece!");
+        activeGameState = ERROR;
+    }
+    else if(clogic.isPlayerDestination(moveTo, activePlayer)){
+        cinterface.setErrorMessasge("Invalid ending coordinates. Cannot move your piece on top of your other piece!");
+        activeGameState = ERROR;
+    }
+    else if(!clogic.isValidPieceMove(moveFrom, moveTo)){
+        cinterface.setErrorMessasge("DESTINATION coordinates is invalid for this piece, or blocked by another piece.");
+        activeGameState = ERROR;
+    }
+    else if(clogic.isMoveCheckForKing(moveFrom, moveTo, activePlayer)){
+        cinterface.setErrorMessasge("Invalid move.  Cannot put your own king in check!");
+        activeGameState = ERROR;
+    } 
+    else{
+        isValid = true;
+        activeGameState = NORMALPLAY;
+    }
+    
+    if(!isValid && eventStream != NULL){
+        eventStream->writeStatus(EVENT_ERROR, activePlayer, cinterface.getErrorMessage());
+    }
+    return isValid;
+}
+
+void chessGame::loopGameplay(){
+    
+    chessInput consoleInput;
+    chessInput* input = (inputSource != NULL) ? inputSource : &consoleInput;
+    string line;
+    
+    // analyse each position in the background from the moment it appears, so hints are ready when asked for.
+    // Against the engine the player's time goes to its pondering instead.
+    if(engineSide != NONE){
+        engine.reset(new chessEngine(engineLimits, isEnginePondering));
+    }
+    else{
+        hintEngine.reset(new chessHint());
+    }
+    while(!isGameOver()){
+        if(gameClock.hasFlagged()){
+            loseOnTime();
+            break;
+        }
+        if(activePlayer == engineSide){
+            playEngineMove();
+            continue;
+        }
+        if(hintEngine){
+            hintEngine->analyze(this);
+        }
+        // wait briefly for the player, doing idle work whenever no full line has been typed yet
+        if(input->pollLine(&line, idlePollInterval)){
+            cinterface.noteInput(line);
+            handleInput(line);
+        }
+        else if(input->isClosed()){
+            break;
+        }
+        else if(idleTask){
+            idleTask();
+        }
+    }
+    engine.reset();
+    hintEngine.reset();
+}
+
+void chessGame::startTurn(){
+    bool isOutOfMoves;
+    
+    // check if the results in a stalemate before any action
+    {
+        CHESS_TRACE_SPAN("isPlayerOutOfMoves WHITE");
+        isOutOfMoves = clogic.isPlayerOutOfMoves(WHITE);
+    }
+    if(isOutOfMoves){
+        activeGameState = STALEMATE;
+        if(eventStream != NULL){
+            eventStream->writeStatus(EVENT_STALEMATE, activePlayer, string());
+        }
+        return;
+    }
+    {
+        CHESS_TRACE_SPAN("isPlayerOutOfMoves BLACK");
+        isOutOfMoves = clogic.isPlayerOutOfMoves(BLACK);
+    }
+    if (isOutOfMoves){
+        activeGameState = STALEMATE;
+        if(eventStream != NULL){
+            eventStream->writeStatus(EVENT_STALEMATE, activePlayer, string());
+        }
+        return;
+    }
+    if(gameClock.isEnabled()){
+        gameClock.start(activePlayer);
+    }
+    promptMoveStart();
+}
+
+void chessGame::promptMoveStart(){
+    string playerColor;
+    
+    // draw visual chess board on screen
+    {
+        CHESS_TRACE_SPAN("drawChessBoard");
+        cinterface.drawChessBoard();
+    }
+    cinterface.print("    |||--------------|||");
+    cinterface.print("    ||| " + (playerColor = (activePlayer == WHITE) ? "WHITE" : "BLACK") + "'S TURN |||");
+    cinterface.print("    |||--------------|||");
+    if(gameClock.isEnabled()){
+        cinterface.print("    CLOCK: WHITE " + formatClock(gameClock.getRemaining(WHITE)) + "  BLACK " + formatClock(gameClock.getRemaining(BLACK)));
+    }
+    lastMove.clear();
+    if(activePlayer == engineSide){
+        cinterface.print(">>> The engine is thinking...");
+        return;
+    }
+    // wait for user input
+    cinterface.print(">>> Please enter the STARTING coordinates in Standard Notation (A1, B2, etc): ");
+    inputStep = AWAIT_START;
+}
+
+void chessGame::playEngineMove(){
+    chessMove move = engine->chooseMove(this, gameClock.isEnabled() ? gameClock.getRemaining(activePlayer) : -1, gameClock.getIncrement());
+    moveFrom = move.from;
+    moveTo = move.to;
+    movePromotion = move.promotion;
+    
+    // record the move as squares, like a move entered by a player
+    char squares[4];
+    chessNotation::writeSquare(moveFrom, squares);
+    chessNotation::writeSquare(moveTo, squares + 2);
+    lastMove.assign(squares, 4);
+    if(submitMove()){
+        engine->startPondering(this);
+    }
+}
+
+void chessGame::loseOnTime(){
+    activeGameState = TIMEOUT;
+    gameAction = (activePlayer == WHITE) ? "WHITE RAN OUT OF TIME. " : "BLACK RAN OUT OF TIME. ";
+    if(eventStream != NULL){
+        eventStream->writeStatus(EVENT_TIMEOUT, activePlayer, string());
+    }
+}
+
+bool chessGame::handleInput(string input){
+    CHESS_TRACE_SPAN("handleInput");
+    
+    if(isGameOver()){
+        return false;
+    }
+    
+    if(input.compare(0, 5, "save ") == 0){
+        // write a snapshot to resume the game from later with --resume, then repeat the pending prompt
+        string snapshot;
+        saveSnapshot(&snapshot);
+        ofstream file(input.substr(5), ios::binary | ios::trunc);
+        file.write(snapshot.data(), snapshot.size());
+        cinterface.print(file ? "Game saved to " + input.substr(5) : "Could not write " + input.substr(5));
+        cinterface.print((inputStep == AWAIT_START) ? ">>> Please enter the STARTING coordinates in Standard Notation (A1, B2, etc): "
+                                                    : ">>> Please enter the DESTINATION coordinates in Standard Notation (A1, B2, etc): ");
+        return true;
+    }
+    
+    if(input == "hint"){
+        // the background analysis already holds the answer, so this never waits on a search
+        searchResult result;
+        if(hintEngine && hintEngine->getHint(getPositionHash(), &result)){
+            char san[12];
+            char score[16];
+            cnotation.writeMove(result.bestMove, san);
+            snprintf(score, sizeof(score), "%+.2f", result.score / 100.0);
+            cinterface.print("HINT: " + string(san) + " (" + score + " after " + to_string(result.depth) + " plies)");
+        }
+        else if(hintEngine){
+            cinterface.print("No hint yet, the position is still being analysed.  Try again in a moment.");
+        }
+        else{
+            cinterface.print("Hints are only given in games between two players.");
+        }
+        cinterface.print((inputStep == AWAIT_START) ? ">>> Please enter the STARTING coordinates in Standard Notation (A1, B2, etc): "
+                                                    : ">>> Please enter the DESTINATION coordinates in Standard Notation (A1, B2, etc): ");
+        return true;
+    }
+    
+    if(input == "undo"){
+        // against the engine the player's last move goes back along with the engine's reply
+        int plies = (engineSide != NONE) ? 2 : 1;
+        if(currentPly < plies){
+            cinterface.print("There is no move to take back.");
+            cinterface.print((inputStep == AWAIT_START) ? ">>> Please enter the STARTING coordinates in Standard Notation (A1, B2, etc): "
+                                                        : ">>> Please enter the DESTINATION coordinates in Standard Notation (A1, B2, etc): ");
+            return true;
+        }
+        // the time of this turn is charged before going back, so taking back a move never gains time, and
+        // the engine stops pondering on a reply that may not come
+        if(gameClock.isEnabled() && !gameClock.pause()){
+            loseOnTime();
+            return false;
+        }
+        if(engine){
+            engine->stopPondering();
+        }
+        jumpToPly(currentPly - plies);
+        // the latest move is reported first, the move i plies after the current position was made by
+        // the player to move when i is even
+        for(int i = plies - 1; i >= 0 && eventStream != NULL; i--){
+            eventStream->writeStatus(EVENT_TAKEBACK, (i % 2 == 0) ? activePlayer : ((activePlayer == WHITE) ? BLACK : WHITE), string());
+        }
+        gameAction = (plies == 2) ? "TOOK BACK THE LAST TWO MOVES. " : "TOOK BACK THE LAST MOVE. ";
+        updateGameState();
+        startTurn();
+        return true;
+    }
+    
+    if(input == "stats"){
+        // dump the performance counters, then repeat the pending prompt
+        cinterface.print(chessStats::toJson());
+        cinterface.print((inputStep == AWAIT_START) ? ">>> Please enter the STARTING coordinates in Standard Notation (A1, B2, etc): "
+                                                    : ">>> Please enter the DESTINATION coordinates in Standard Notation (A1, B2, etc): ");
+        return true;
+    }
+    
+    if(inputStep == AWAIT_START){
+        // a whole move on one line, in SAN or as a pair of squares
+        if(readMoveInput(input)){
+            return submitMove();
+        }
+        // a lone square no pawn can move to starts a move in two steps if it holds one of the player's pieces.
+        // A pawn move always goes to an empty square, so the two readings never compete.
+        size_t length = input.find_last_not_of(" \t");
+        coordinates square = validateCoordinates(input);
+        if(length != string::npos && length + 1 <= 2 && square.posX >= 0 && clogic.isPlayerPiece(square, activePlayer)){
+            if(readNotationInput(input, &moveFrom)){
+                cinterface.print(">>> Please enter the DESTINATION coordinates in Standard Notation (A1, B2, etc): ");
+                inputStep = AWAIT_DESTINATION;
+            }
+            return true;
+        }
+        cinterface.setErrorMessasge("Move not recognized, or it is illegal or ambiguous. Try e4, Nf3, exd5, O-O or E2E4.");
+        activeGameState = ERROR;
+        if(eventStream != NULL){
+            eventStream->writeStatus(EVENT_ERROR, activePlayer, cinterface.getErrorMessage());
+        }
+        promptMoveStart();
+        return true;
+    }
+    
+    if(!readNotationInput(input, &moveTo)){
+        return true;
+    }
+    movePromotion = NOPIECE;
+    if(!isValidMove()){
+        // redraw the board with the reason and ask for a new move
+        promptMoveStart();
+        return true;
+    }
+    return submitMove();
+}
+
+bool chessGame::submitMove(){
+    char san[12];
+    
+    // if the move is legal and valid, perform the move
+    cnotation.writeMove({moveFrom, moveTo, movePromotion}, san);
+    gameAction = lastMove.substr(0,2) + " to " + lastMove.substr(2,2) + " (" + san + "). "; // updates the output display of last move
+    
+    // a move made after the flag fell comes too late
+    if(gameClock.isEnabled() && !gameClock.stop()){
+        loseOnTime();
+        return false;
+    }
+    completeTurn();
+    
+    // update game and draw board once ready
+    {
+        CHESS_TRACE_SPAN("updateGameState");
+        updateGameState();
+    }
+    if(!isGameOver()){
+        startTurn();
+    }
+    return !isGameOver();
+}
+
+bool chessGame::isGameOver(){
+    return activeGameState == CHECKMATE || activeGameState == STALEMATE || activeGameState == DRAW || activeGameState == TIMEOUT;
+}
+
+void chessGame::setIdleTask(function<void()> task){
+    idleTask = task;
+}
+
+void chessGame::setInputSource(chessInput* input){
+    inputSource = input;
+}
+
+void chessGame::setEventStream(chessEventStream* stream){
+    eventStream = stream;
+}
+
+void chessGame::setEngine(color side, searchLimits limits, bool ponder){
+    engineSide = side;
+    engineLimits = limits;
+    isEnginePondering = ponder;
+}
+
+void chessGame::setClock(int baseTime, int increment){
+    gameClock.setTimeControl(baseTime, increment);
+}
+
+void chessGame::completeTurn(){
+    bool isCheck;
+    activeGameState = NORMALPLAY;
+    {
+        CHESS_TRACE_SPAN("doMove");
+        doMove(moveFrom, moveTo);
+    }
+    
+    // check if either player is in check
+    {
+        CHESS_TRACE_SPAN("isPlayerInCheck WHITE");
+        isCheck = clogic.isPlayerInCheck(WHITE);
+    }
+    if(isCheck){
+        playerInCheck = WHITE;
+        activeGameState = CHECK;
+    }
+    else{
+        {
+            CHESS_TRACE_SPAN("isPlayerInCheck BLACK");
+            isCheck = clogic.isPlayerInCheck(BLACK);
+        }
+        if(isCheck){
+            playerInCheck = BLACK;
+            activeGameState = CHECK;
+        }
+        else{
+            playerInCheck = NONE;
+        }
+    }
+    
+    // if check is active, check for checkmate
+    if(activeGameState == CHECK){
+        CHESS_TRACE_SPAN("checkmate detection");
+        if(clogic.isPlayerOutOfMoves(playerInCheck)){
+          activeGameState = CHECKMATE;
+        }
+    }
+    
+    // after turn is complete, change to opposing color's turn
+    if(activePlayer == WHITE){
+        activePlayer = BLACK;
+    }
+    else {
+        activePlayer = WHITE;
+    }
+    
+    // record the new position, then check for a draw by repetition or the fifty-move rule
+    history.push(getPositionHash(), positionRights.halfmoveClock);
+    if(activeGameState != CHECKMATE){
+        if(history.isThreefold()){
+            activeGameState = DRAW;
+            gameAction += "DRAW BY THREEFOLD REPETITION. ";
+        }
+        else if(history.isFiftyMoveDraw()){
+            activeGameState = DRAW;
+            gameAction += "DRAW BY THE FIFTY-MOVE RULE. ";
+        }
+    }
+    
+    moveLog.record(currentPly++, &chessBoard, activePlayer, positionRights,
+                   {{moveFrom, moveTo, movePromotion}, history.getLatestHash(), positionRights.halfmoveClock, activeGameState, playerInCheck});
+    
+    if(eventStream != NULL){
+        if(activeGameState == CHECKMATE){
+            eventStream->writeStatus(EVENT_CHECKMATE, playerInCheck, string());
+        }
+        else if(playerInCheck != NONE){
+            eventStream->writeStatus(EVENT_CHECK, playerInCheck, string());
+        }
+        if(activeGameState == DRAW){
+            eventStream->writeStatus(EVENT_DRAW, activePlayer, history.isThreefold() ? "threefold repetition" : "fifty-move rule");
+        }
+    }
+}
+
+bool chessGame::replayMove(coordinates from, coordinates to){
+    if(activeGameState == CHECKMATE || activeGameState == STALEMATE){
+        return false;
+    }
+    moveFrom = from;
+    moveTo = to;
+    movePromotion = NOPIECE;
+    if(!isValidMove()){
+        return false;
+    }
+    // capture messages are only kept for the move being replayed
+    gameAction.clear();
+    completeTurn();
+    return true;
+}
+
+bool chessGame::playNotation(string_view text, char* san){
+    chessMove move;
+    
+    // like replayMove(), recorded games may play on past a drawn position
+    if(activeGameState == CHECKMATE || activeGameState == STALEMATE || !cnotation.parseMove(text, &move)){
+        return false;
+    }
+    if(san != NULL){
+        cnotation.writeMove(move, san);
+    }
+    return playMove(move);
+}
+
+bool chessGame::playMove(chessMove move){
+    if(activeGameState == CHECKMATE || activeGameState == STALEMATE){
+        return false;
+    }
+    moveFrom = move.from;
+    moveTo = move.to;
+    movePromotion = move.promotion;
+    gameAction.clear();
+    completeTurn();
+    return true;
+}
+
+void chessGame::writeLine(const vector<chessMove>& line, string* text){
+    vector<moveUndo> undo(line.size());
+    char san[12];
+    color firstPlayer = activePlayer;
+    
+    // each move is written before it is played, so the check suffixes come out right, then all are taken back
+    text->clear();
+    for(int i = 0; i < line.size(); i++){
+        if(activePlayer == WHITE || i == 0){
+            *text += (text->empty() ? "" : " ") + to_string((i + (firstPlayer == BLACK)) / 2 + 1)
+                     + ((activePlayer == WHITE) ? "." : "...");
+        }
+        cnotation.writeMove(line[i], san);
+        *text += string(" ") + san;
+        clogic.makeMove(line[i], &undo[i]);
+        activePlayer = (activePlayer == WHITE) ? BLACK : WHITE;
+    }
+    for(int i = line.size() - 1; i >= 0; i--){
+        clogic.unmakeMove(undo[i]);
+    }
+    activePlayer = firstPlayer;
+}
+
+bool chessGame::readMove(string_view text, chessMove* move){
+    return cnotation.parseMove(text, move);
+}
+
+void chessGame::writeMove(chessMove move, char* san){
+    cnotation.writeMove(move, san);
+}
+
+bool chessGame::jumpToPly(int ply){
+    if(ply < 0 || ply >= moveLog.getLength()){
+        return false;
+    }
+    moveLog.restore(ply, &chessBoard, &activePlayer, &positionRights, &clogic);
+    const loggedPosition& position = moveLog.getPosition(ply);
+    activeGameState = position.state;
+    playerInCheck = position.inCheck;
+    currentPly = ply;
+    inputStep = AWAIT_START;
+    
+    // only the positions since the last capture or pawn move can still repeat
+    history.clear();
+    for(int i = (ply > position.halfmoveClock) ? ply - position.halfmoveClock : 0; i <= ply; i++){
+        history.push(moveLog.getPosition(i).hash, moveLog.getPosition(i).halfmoveClock);
+    }
+    return true;
+}
+
+int chessGame::getPlyCount(){
+    return moveLog.getLength() - 1;
+}
+
+int chessGame::getCurrentPly(){
+    return currentPly;
+}
+
+void chessGame::getLegalMoves(vector<chessMove>* moves){
+    clogic.generateLegalMoves(activePlayer, moves);
+}
+
+color chessGame::getActivePlayer(){
+    return activePlayer;
+}
+
+void chessGame::setupSearch(chessSearch* search){
+    search->setPosition(&chessBoard, activePlayer, positionRights, history);
+}
+
+bool chessGame::loadPosition(string_view fen){
+    
+    resetGame();
+    if(!chessNotation::parseFen(fen, &chessBoard, &activePlayer, &positionRights)){
+        resetGame();
+        return false;
+    }
+    
+    // work out check, mate and stalemate for the new position
+    gameAction.clear();
+    color opponent = (activePlayer == WHITE) ? BLACK : WHITE;
+    playerInCheck = clogic.isPlayerInCheck(activePlayer) ? activePlayer : NONE;
+    if(clogic.isPlayerInCheck(opponent)){
+        // the side that just moved cannot be in check
+        resetGame();
+        return false;
+    }
+    if(clogic.isPlayerOutOfMoves(activePlayer)){
+        activeGameState = (playerInCheck != NONE) ? CHECKMATE : STALEMATE;
+    }
+    else{
+        activeGameState = (playerInCheck != NONE) ? CHECK : NORMALPLAY;
+    }
+    history.clear();
+    history.push(getPositionHash(), positionRights.halfmoveClock);
+    startMoveLog();
+    return true;
+}
+
+uint64_t chessGame::perft(int depth, vector<string>* divide){
+    vector<chessMove> moves;
+    uint64_t total = 0, nodes;
+    char text[5];
+    
+    clogic.generateLegalMoves(activePlayer, &moves);
+    
+    // every first move is counted by its own task on the shared pool, on its own copy of the position
+    vector<uint64_t> moveNodes(moves.size());
+    chessThreadPool& pool = chessThreadPool::getShared();
+    chessTaskGroup tasks;
+    for(int i = 0; i < moves.size(); i++){
+        pool.submit(&tasks, [this, &moves, &moveNodes, i, depth](){
+            chessTile board[8][8];
+            for(int x = 0; x < 8; x++){
+                for(int y = 0; y < 8; y++){
+                    board[x][y] = chessBoard[x][y];
+                }
+            }
+            color side = activePlayer, check = NONE;
+            boardRights rights = positionRights;
+            chessLogic logic(&board, &side, &check, &rights);
+            moveUndo undo;
+            logic.makeMove(moves[i], &undo);
+            side = (side == WHITE) ? BLACK : WHITE;
+            moveNodes[i] = logic.perft(depth - 1);
+        });
+    }
+    pool.wait(&tasks);
+    
+    for(int i = 0; i < moves.size(); i++){
+        nodes = moveNodes[i];
+        total += nodes;
+        
+        if(divide != NULL){
+            // the move in coordinate form, with a lower case promotion letter as in "e7e8q"
+            chessNotation::writeSquare(moves[i].from, text);
+            chessNotation::writeSquare(moves[i].to, text + 2);
+            string line(text, 4);
+            if(moves[i].promotion != NOPIECE){
+                line += "prnbqk"[moves[i].promotion];
+            }
+            divide->push_back(line + ": " + to_string(nodes));
+        }
+    }
+    return total;
+}
+
+uint64_t chessGame::getPositionHash(){
+    return chessHash::hashBoard(&chessBoard, activePlayer, &positionRights);
+}
+
+void chessGame::saveSnapshot(string* out){
+    snapshotHeader header = {};
+    memcpy(header.magic, "CHGS", 4);
+    header.version = snapshotVersion;
+    for(int i = 0; i < 8; i++){
+        for(int j = 0; j < 8; j++){
+            pieceData piece = chessBoard[i][j].getActivePiece();
+            header.board[i * 8 + j] = (piece.pieceType == NOPIECE) ? 0xFF : piece.pieceType + 8 * piece.pieceColor;
+        }
+    }
+    header.activePlayer = activePlayer;
+    header.playerInCheck = playerInCheck;
+    header.gameState = activeGameState;
+    header.inputStep = inputStep;
+    // the starting square only means something while the destination is awaited
+    header.moveFromX = (inputStep == AWAIT_DESTINATION) ? moveFrom.posX : -1;
+    header.moveFromY = (inputStep == AWAIT_DESTINATION) ? moveFrom.posY : -1;
+    header.enPassantX = positionRights.enPassant.posX;
+    header.enPassantY = positionRights.enPassant.posY;
+    header.castling = positionRights.castling;
+    header.halfmoveClock = positionRights.halfmoveClock;
+    header.actionLength = (gameAction.size() < 0xFFFF) ? gameAction.size() : 0xFFFF;
+    header.lastMoveLength = (lastMove.size() < 0xFFFF) ? lastMove.size() : 0xFFFF;
+    
+    // the header, the texts shown on screen, the position history for the draw rules, then the ply being
+    // played from and the move log
+    out->append(reinterpret_cast<const char*>(&header), sizeof(header));
+    out->append(gameAction, 0, header.actionLength);
+    out->append(lastMove, 0, header.lastMoveLength);
+    history.save(out);
+    int32_t ply = currentPly;
+    out->append(reinterpret_cast<const char*>(&ply), sizeof(ply));
+    moveLog.save(out);
+    
+    snapshotSettings settings = {};
+    settings.baseTime = gameClock.getBaseTime();
+    settings.increment = gameClock.getIncrement();
+    settings.remaining[WHITE] = gameClock.getRemaining(WHITE);
+    settings.remaining[BLACK] = gameClock.getRemaining(BLACK);
+    settings.engineSide = engineSide;
+    settings.isPondering = isEnginePondering;
+    settings.engineDepth = engineLimits.depth;
+    settings.engineNodes = engineLimits.nodes;
+    out->append(reinterpret_cast<const char*>(&settings), sizeof(settings));
+}
+
+bool chessGame::loadSnapshot(string_view data){
+    snapshotHeader header;
+    
+    resetGame();
+    if(data.size() < sizeof(header)){
+        return false;
+    }
+    memcpy(&header, data.data(), sizeof(header));
+    data.remove_prefix(sizeof(header));
+    // a snapshot may come from anywhere, so nothing in it is trusted to index the board unchecked. The square a
+    // move is being entered from has to exist, and the en passant square is either a square or -1,-1.
+    bool isMoveFromValid = (header.inputStep == AWAIT_START) || isSquare(header.moveFromX, header.moveFromY);
+    bool isEnPassantValid = isSquare(header.enPassantX, header.enPassantY) || (header.enPassantX == -1 && header.enPassantY == -1);
+    if(memcmp(header.magic, "CHGS", 4) != 0 || (header.version < 1 || header.version > snapshotVersion) || header.activePlayer > BLACK
+       || header.playerInCheck > NONE || header.gameState > TIMEOUT || header.inputStep > AWAIT_DESTINATION
+       || !isMoveFromValid || !isEnPassantValid || data.size() < header.actionLength + header.lastMoveLength){
+        return false;
+    }
+    // every check test looks for the king, so each side needs exactly one
+    int kings[2] = {0, 0};
+    for(int i = 0; i < 64; i++){
+        uint8_t square = header.board[i];
+        if(square != 0xFF && (square % 8 >= NOPIECE || square / 8 > BLACK)){
+            resetGame();
+            return false;
+        }
+        if(square != 0xFF && square % 8 == KING){
+            kings[square / 8]++;
+        }
+        chessBoard[i / 8][i % 8] = (square == 0xFF) ? chessTile() : chessTile(chessPiece(chessPieceType(square % 8), color(square / 8)));
+    }
+    if(kings[WHITE] != 1 || kings[BLACK] != 1){
+        resetGame();
+        return false;
+    }
+    gameAction.assign(data.data(), header.actionLength);
+    lastMove.assign(data.data() + header.actionLength, header.lastMoveLength);
+    data.remove_prefix(header.actionLength + header.lastMoveLength);
+    if(!history.load(&data)){
+        resetGame();
+        return false;
+    }
+    activePlayer = color(header.activePlayer);
+    positionRights = {header.castling & 15, {header.enPassantX, header.enPassantY}, header.halfmoveClock};
+    
+    if(header.version == 1){
+        startMoveLog();
+    }
+    else{
+        // the log is replayed from its first position, and has to lead to the very position saved
+        uint64_t hash = getPositionHash();
+        chessHistory savedHistory = history;
+        int32_t ply;
+        if(data.size() < sizeof(ply)){
+            resetGame();
+            return false;
+        }
+        memcpy(&ply, data.data(), sizeof(ply));
+        data.remove_prefix(sizeof(ply));
+        if(!moveLog.load(&data, &chessBoard, &activePlayer, &positionRights, &clogic) || !jumpToPly(ply) || getPositionHash() != hash){
+            resetGame();
+            return false;
+        }
+        history = savedHistory;
+    }
+    if(header.version >= 3){
+        // an engine needs a limit or a clock to stop its search, as on the command line
+        snapshotSettings settings;
+        if(data.size() < sizeof(settings)){
+            resetGame();
+            return false;
+        }
+        memcpy(&settings, data.data(), sizeof(settings));
+        data.remove_prefix(sizeof(settings));
+        bool isEngineValid = settings.engineSide == NONE || settings.engineDepth > 0 || settings.engineNodes > 0 || settings.baseTime > 0;
+        if(settings.engineSide > NONE || settings.engineDepth < 0 || settings.baseTime < 0 || settings.increment < 0 || !isEngineValid){
+            resetGame();
+            return false;
+        }
+        setEngine(color(settings.engineSide), {settings.engineDepth, settings.engineNodes}, settings.isPondering != 0);
+        setClock(settings.baseTime, settings.increment);
+        gameClock.setRemaining(WHITE, settings.remaining[WHITE]);
+        gameClock.setRemaining(BLACK, settings.remaining[BLACK]);
+    }
+    playerInCheck = color(header.playerInCheck);
+    activeGameState = gameState(header.gameState);
+    inputStep = inputStage(header.inputStep);
+    moveFrom = (inputStep == AWAIT_DESTINATION) ? coordinates{header.moveFromX, header.moveFromY} : coordinates{-1, -1};
+    return true;
+}
+
+gameState chessGame::getGameState(){
+    return activeGameState;
+}
+
+void chessGame::capturePiece(chessPieceType attackingPiece, chessPieceType capturedPiece, color c){
+    string str;
+    chessPieceType pieceEval = attackingPiece;
+    str += (c == WHITE) ? "WHITE " : "BLACK ";
+    
+    for(int i = 0; i < 2; i++){
+        switch(pieceEval){
+            case PAWN: 
+                str += "PAWN";
+                break;
+            case ROOK:
+                str += "ROOK";
+                break;
+            case KNIGHT:
+                str += "KNIGHT";
+                break;
+            case BISHOP:
+                str += "BISHOP";
+                break;
+            case QUEEN:
+                str += "QUEEN";
+                break;
+            case KING:
+                str += "KING";
+                break;
+        }
+        
+        if(i == 0){
+            str += " CAPTURES ";
+            str += (c == WHITE) ? "BLACK " : "WHITE ";
+            pieceEval = capturedPiece;
+        }
+        else{
+            str += ".";
+        } 
+    }
+    
+    gameAction += str;
+}
+
+void chessGame::startMoveLog(){
+    currentPly = 0;
+    moveLog.start(&chessBoard, activePlayer, positionRights,
+                  {{{-1, -1}, {-1, -1}, NOPIECE}, getPositionHash(), positionRights.halfmoveClock, activeGameState, playerInCheck});
+}
+
+void chessGame::doMove(coordinates from, coordinates to){ 
+    moveUndo undo;
+    
+    // move the piece, along with the rook when castling, the pawn taken en passant or the promoted piece
+    clogic.makeMove({from, to, movePromotion}, &undo);
+    
+    // report the move with the piece a pawn was promoted to, which is a QUEEN when none was chosen
+    if(eventStream != NULL){
+        chessPieceType moved = undo.movedPiece.getActivePiece().pieceType;
+        chessPieceType landed = chessBoard[to.posX][to.posY].getActivePiece().pieceType;
+        eventStream->writeMove(activePlayer, {from, to, (landed != moved) ? landed : NOPIECE}, moved);
+    }
+    
+    // check if the player captured an enemy piece
+    if(undo.capturedPiece.getControllingPlayer() != NONE){
+        capturePiece(undo.movedPiece.getActivePiece().pieceType, undo.capturedPiece.getActivePiece().pieceType, activePlayer);
+        if(eventStream != NULL){
+            eventStream->writeCapture(activePlayer, undo.movedPiece.getActivePiece().pieceType,
+                                      undo.capturedPiece.getActivePiece().pieceType, undo.capturedAt);
+        }
+    }
+}
+
+void chessGame::endGame(){
+    switch(activeGameState){
+        case CHECKMATE:
+            gameAction += (playerInCheck == WHITE) ? "CHECKMATE ON WHITE. BLACK WINS!!" : "CHECKMATE ON BLACK. WHITE WINS!!";
+            break;
+        case STALEMATE:
+            gameAction += "STALEMATE. GAME IS A DRAW.";
+            break;    
+        case DRAW:
+            gameAction += "GAME IS A DRAW.";
+            break;
+        case TIMEOUT:
+            gameAction += (activePlayer == WHITE) ? "BLACK WINS ON TIME!!" : "WHITE WINS ON TIME!!";
+            break;
+    }
+    
+    updateGameState();
+    cinterface.drawChessBoard();
+    cinterface.print("Engine stats: " + chessStats::toJson());
+#ifdef CHESS_TRACE
+    if(chessTrace::exportJson("chessTrace.json")){
+        cinterface.print("Turn trace written to chessTrace.json");
+    }
+#endif
+    cinterface.print("Game is over. Returning to main menu...");
+    return;
 }
\ No newline at end of file
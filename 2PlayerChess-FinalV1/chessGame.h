@@ -1,132 +1,438 @@
-/*      Author: Drew Tibbetts
- *      Creation Date: 6/22/2019
- *      Modification: 8/6/2019
- *      FileName: chessGame.h
- *      Purpose: Contains member and method declaration for chessGame class.  Manages the entire 2-Player Chess Game
- *      Input: Receives string input from users through getNotationInput() method.
- *      Output: Void. When class methods resolve game returns to main menu.
- *      Exceptions: Input validation is handled through getNotationInput().
- * 
- */
-
-#ifndef CHESSGAME_H
-#define CHESSGAME_H
-#include <cstdlib>
-#include <string>
-#include "globals.h"
-#include "chessInterface.h"
-#include "chessLogic.h"
-#include "chessTile.h"
-#include "chessPiece.h"
-
-using namespace std;
-
-class chessGame {
-public:
-    chessGame();
-//     Purpose: Default constructor. Empty.
-//     Input:   None.
-//     Output:  None.
-//     Caller:  Main.activeGame 
-//    
-    void startNewGame();
-    // Purpose: Initializes a game of 2-Player Chess.  Sets up all game components and starts main game play loop.
-    // Input:   None.
-    // Output:  None.
-    // Caller:  Main.activeGame
-    //
-    void setupChessBoard(); 
-    // Purpose: Sets up the virtual 8x8 chess board for game play.  Spawns the chess pieces and creates the game board.
-    // Input:   None.
-    // Output:  None.
-    // Caller:  chessGame::StartNewGame();   
-    //
-    void spawnPiece(chessPieceType, color, coordinates);
-    // Purpose: Creates a virtual chess piece of specific type and color, then puts the piece on a space on the chessboard.
-    // Input:   chessPieceType p - The type of chess piece to spawn. (Pawn, Rook, Knight, Bishop, Queen, King, NOPIECE)
-    //          color c - The color of the chess piece to create. (WHITE, BLACK, NONE)
-    //          coordinates coords - The x,y position on the chessBoard game board to spawn the chess piece at.
-    // Output:  None.
-    // Caller:  chessGame::SetupChessBoard();
-    //
-    void updateGameState();
-    // Purpose: Notifies the instanced chessInterface object 'cinterface' of updated game play data: which player's turn 
-    //          it is, whether anybody is in check/checkmate/stalemate, and what the last action was in game.
-    // Input:   None.
-    // Output:  None.
-    // Caller:  chessGame::loopGamePlay(), chessGame::endGame();
-    //
-    void loopGameplay();
-    // Purpose: Handles the main game play loop of 2-player chess. Continues until either a player is in checkmate,
-    //          or the board state is in a stalemate.  
-    // Input:   None.
-    // Output:  None.
-    // Caller:  chessGame::StartNewGame();
-    //
-    coordinates getNotationInput();
-    // Purpose: Receives user input and converts the input into valid game data, looping until validated per each input.
-    //          User input is entered in Standard Algebraic Notation, then converted internally into x,y coordinates. 
-    // Input:   None;
-    // Output:  Returns a coordinate struct of x,y coordinates that denote the position on the chess board.
-    // Caller:  chessGame::loopGameplay;
-    //
-    coordinates validateCoordinates(string);
-    // Purpose: Converts Standard Algebraic Notation chess coordinates into coordinate struct x,y values for game play.
-    // Input:   string s - User string input passed through to the function.
-    // Output:  coordinate coords - Returns x,y struct that denotes position on the game board.
-    // Caller:  chessGame::getNotationInput();
-    //
-    bool isValidMove();
-    // Purpose: Runs through a series of checks that validates whether the users inputted move is legally valid in
-    //          a game of 2-Player Chess.  If the move is invalid, a specific reason is passed through to the on
-    //          screen game interface.
-    // Input:   None.
-    // Output:  bool isValid - Returns TRUE if the move is legal, and FALSE if there is a reason it is not.
-    // Caller:  chessGame::loopGamePlay();
-    void capturePiece(chessPieceType, chessPieceType, color);
-    // Purpose: When a player successfully lands their piece on an opposing player's piece, this function
-    //          properly notifies the user interface by adding data to the gameAction string variable.
-    // Input:   chessPieceType attackingPiece - The type of chess piece that is attacking.
-    //          chessPieceType capturedPiece -  The type of chess piece that is captured.
-    //          color c - Color of the piece that is attacking.
-    // Output:  None.
-    // Caller:  chessGame::doMove();
-    //
-    void doMove(coordinates, coordinates);
-    // Purpose: Handles the logic for actually moving a chess piece on the virtual game board, including if an
-    //          opposing player's piece is captured during the movement process.
-    // Input:   coordinates from - The starting x,y position of the move on the game board. 
-    //          coordinates to - The destination x,y position of where to move the piece on the game board.
-    // Output:  None.
-    // Caller:  chessGame::loopGameplay();
-    //
-    void endGame();
-    // Purpose: Handles the process of actually ending the game once a winner or stalemate is declared.
-    // Input:   None.
-    // Output:  None.
-    // Caller: Main.activeGame
-    //
-    
-private:
-    chessLogic clogic;
-    // Holds instance of a chessLogic object that governs game play mechanics.
-    chessInterface cinterface;
-    // Holds instance of a chessInterface object that handles on screen output / user interface.
-    chessTile chessBoard[8][8] = {};
-    // Virtual representation of the 8x8 standard chess board.
-    coordinates moveFrom, moveTo;
-    // Represents a player's inputted desired move.
-    color activePlayer = WHITE;
-    // Holds the value of which player's turn is currently active.
-    color playerInCheck = NONE;
-    // Holds the value of which if any player is currently in 'Check'.
-    gameState activeGameState = NORMALPLAY;
-    // Holds the value of the state of the game, whether the game is normal, error, check, checkmate, or stalemate.
-    string lastMove;
-    // Holds data of the last inputted move, in Standard Algebraic Notation
-    string gameAction = "New Game Started. White Moves First.";
-    // Holds relevant data to the last gameplay action.
-};
-
-#endif /* CHESSGAME_H */
-
+/*      Author: Drew Tibbetts
+ *      Creation Date: 6/22/2019
+ *      Modification: 10/19/2026
+ *      FileName: chessGame.h
+ *      Purpose: Contains member and method declaration for chessGame class.  Manages the entire 2-Player Chess Game
+ *      Input: Receives string input from users through handleInput() one line at a time.
+ *      Output: Void. When class methods resolve game returns to main menu.
+ *      Exceptions: Input validation is handled through readNotationInput().
+ * 
+ */
+
+#ifndef CHESSGAME_H
+#define CHESSGAME_H
+#include <cstdlib>
+#include <string>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <vector>
+#include "globals.h"
+#include "chessInterface.h"
+#include "chessInput.h"
+#include "chessLogic.h"
+#include "chessNotation.h"
+#include "chessHistory.h"
+#include "chessMoveLog.h"
+#include "chessSearch.h"
+#include "chessHint.h"
+#include "chessEngine.h"
+#include "chessClock.h"
+#include "chessEventStream.h"
+#include "chessTile.h"
+#include "chessPiece.h"
+
+using namespace std;
+
+class chessGame {
+public:
+    chessGame();
+//     Purpose: Default constructor. Empty.
+//     Input:   None.
+//     Output:  None.
+//     Caller:  Main.activeGame 
+//    
+    void startNewGame();
+    // Purpose: Initializes a game of 2-Player Chess.  Sets up all game components and starts main game play loop.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  Main.activeGame
+    //
+    void resumeGame();
+    // Purpose: Continues a game restored by loadSnapshot() in the main game play loop, at the step of entering
+    //          a move it was saved at.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  main();
+    //
+    void resetGame();
+    // Purpose: Sets up the board and all game components for a new game without starting the game play loop.
+    //          Used on its own for headless games, such as replaying games from an archive.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::startNewGame(); chessIndex::indexGame();
+    //
+    void setupChessBoard(); 
+    // Purpose: Sets up the virtual 8x8 chess board for game play.  Spawns the chess pieces and creates the game board.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::StartNewGame();   
+    //
+    void spawnPiece(chessPieceType, color, coordinates);
+    // Purpose: Creates a virtual chess piece of specific type and color, then puts the piece on a space on the chessboard.
+    // Input:   chessPieceType p - The type of chess piece to spawn. (Pawn, Rook, Knight, Bishop, Queen, King, NOPIECE)
+    //          color c - The color of the chess piece to create. (WHITE, BLACK, NONE)
+    //          coordinates coords - The x,y position on the chessBoard game board to spawn the chess piece at.
+    // Output:  None.
+    // Caller:  chessGame::SetupChessBoard();
+    //
+    void updateGameState();
+    // Purpose: Notifies the instanced chessInterface object 'cinterface' of updated game play data: which player's turn 
+    //          it is, whether anybody is in check/checkmate/stalemate, and what the last action was in game.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::loopGamePlay(), chessGame::endGame();
+    //
+    void loopGameplay();
+    // Purpose: Handles the main game play loop of 2-player chess. Continues until either a player is in checkmate,
+    //          or the board state is in a stalemate, or standard input is closed.  Input is polled without blocking
+    //          and fed to handleInput(); the idle task runs while the player is thinking, and every position
+    //          is analysed in the background for hints.  If the engine plays a side it moves whenever it is
+    //          its turn, and ponders instead of giving hints.  On a clock the game is lost by the player
+    //          whose time runs out.  The caller prompts for the first move.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::StartNewGame(); chessGame::resumeGame();
+    //
+    void startTurn();
+    // Purpose: Begins the active player's turn.  Ends the game in a stalemate if a player is out of moves,
+    //          otherwise starts the player's clock, draws the board and prompts for the starting coordinates.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::startNewGame(); chessGame::resumeGame(); chessGame::submitMove();
+    //
+    void promptMoveStart();
+    // Purpose: Draws the board and prompts the active player for the STARTING coordinates of a move.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::startTurn(); chessGame::handleInput();
+    //
+    void playEngineMove();
+    // Purpose: Plays the engine's move when it is the engine's turn, then lets it ponder on the player's reply.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::loopGameplay();
+    //
+    void loseOnTime();
+    // Purpose: Ends the game as lost by the active player, whose time has run out.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::loopGameplay(); chessGame::submitMove();
+    //
+    bool handleInput(string);
+    // Purpose: Advances the game by one line of player input.  The game is a state machine that waits for the
+    //          STARTING and then the DESTINATION coordinates, so input can come from any source and several games
+    //          can be driven from one thread without blocking on any of them.  "stats" prints the engine's
+    //          performance counters at any point without affecting the game, "save <file>" writes a
+    //          snapshot of the game to resume it from later, "hint" shows the best move the background
+    //          analysis has found so far, and "undo" takes back the last move, or against the engine the
+    //          player's last move and the engine's reply.
+    // Input:   string input - One line of user input.
+    // Output:  Returns FALSE once the game is over, TRUE while it still expects input.
+    // Caller:  chessGame::loopGameplay();
+    //
+    bool isGameOver();
+    // Purpose: Checks whether the game has ended in checkmate, stalemate, a draw by repetition or the
+    //          fifty-move rule, or on time.
+    // Input:   None.
+    // Output:  Returns TRUE if the game is over.
+    // Caller:  chessGame::loopGameplay(); chessGame::handleInput(); chessTournament::playOpening();
+    //
+    void setIdleTask(function<void()>);
+    // Purpose: Sets work to run while loopGameplay() is waiting for the player, such as analysis or autosave.
+    //          The task is called roughly every 50ms of idle time and should return quickly.
+    // Input:   function<void()> task - The task to run, or an empty function for none.
+    // Output:  None.
+    // Caller:  None;
+    //
+    void setInputSource(chessInput*);
+    // Purpose: Sets the line reader loopGameplay() takes player input from.  Sharing one reader with the main menu
+    //          keeps typed-ahead lines from being lost between the menu and the game.
+    // Input:   chessInput* input - The input source, or NULL to read standard input directly.
+    // Output:  None.
+    // Caller:  main();
+    //
+    void setEventStream(chessEventStream*);
+    // Purpose: Reports every move, capture, check, end of game and rejected move of this game to an event
+    //          stream as well as on screen.
+    // Input:   chessEventStream* stream - The stream, or NULL for none.
+    // Output:  None.
+    // Caller:  main();
+    //
+    void setEngine(color, searchLimits, bool);
+    // Purpose: Lets the built-in engine play one side of the games started afterwards.
+    // Input:   color side - The side the engine plays, NONE for a game between two players.
+    //          searchLimits limits - Depth and node limits of each engine move.
+    //          bool isPonderEnabled - TRUE to let the engine search on the player's time.
+    // Output:  None.
+    // Caller:  main();
+    //
+    void setClock(int, int);
+    // Purpose: Plays the games started afterwards on a clock.  A player whose time runs out loses the game.
+    // Input:   int baseTime - Milliseconds each player starts with, 0 to play without a clock.
+    //          int increment - Milliseconds added to a player's time after each of their moves.
+    // Output:  None.
+    // Caller:  main();
+    //
+    bool readNotationInput(string, coordinates*);
+    // Purpose: Converts one line of user input in Standard Algebraic Notation into x,y coordinates, asking the
+    //          user to try again if the input is not a valid square.
+    // Input:   string input - One line of user input.
+    //          coordinates* coords - Receives the x,y position on the chess board.
+    // Output:  Returns TRUE if the input was a valid square.
+    // Caller:  chessGame::handleInput();
+    //
+    coordinates validateCoordinates(string);
+    // Purpose: Converts Standard Algebraic Notation chess coordinates into coordinate struct x,y values for game play.
+    // Input:   string s - User string input passed through to the function.
+    // Output:  coordinate coords - Returns x,y struct that denotes position on the game board, -1,-1 if invalid.
+    // Caller:  chessGame::readNotationInput();
+    //
+    bool readMoveInput(string);
+    // Purpose: Converts a whole move typed on one line, in SAN ("Nf3", "exd5", "O-O") or as a pair of squares
+    //          ("e2e4"), into moveFrom, moveTo and movePromotion.
+    // Input:   string input - One line of user input.
+    // Output:  Returns TRUE if the input names exactly one legal move for the active player.
+    // Caller:  chessGame::handleInput();
+    //
+    bool submitMove();
+    // Purpose: Plays the validated move entered by the player, updates the screen and begins the next turn.
+    // Input:   None.
+    // Output:  Returns FALSE once the game is over, TRUE while it still expects input.
+    // Caller:  chessGame::handleInput();
+    //
+    bool isValidMove();
+    // Purpose: Runs through a series of checks that validates whether the users inputted move is legally valid in
+    //          a game of 2-Player Chess.  If the move is invalid, a specific reason is passed through to the on
+    //          screen game interface.
+    // Input:   None.
+    // Output:  bool isValid - Returns TRUE if the move is legal, and FALSE if there is a reason it is not.
+    // Caller:  chessGame::handleInput(); chessGame::replayMove();
+    //
+    bool replayMove(coordinates, coordinates);
+    // Purpose: Plays a single move without any console input or output.  The move is validated with the same
+    //          checks as an interactive move, then applied through doMove() and completeTurn().
+    // Input:   coordinates from - The starting x,y position of the move on the game board.
+    //          coordinates to - The destination x,y position of the move on the game board.
+    // Output:  bool isValid - Returns TRUE if the move was legal and has been played, FALSE if it was rejected.
+    // Caller:  chessIndex::indexGame();
+    //
+    bool playNotation(string_view, char*);
+    // Purpose: Plays a single move given in SAN or coordinate notation, without any console input or output.
+    // Input:   string_view text - The move, e.g. "Nf3", "exd8=Q+", "O-O" or "e2e4".
+    //          char* san - If not NULL, receives the move rewritten in SAN (at least 10 characters).
+    // Output:  Returns TRUE if the move was legal and has been played, FALSE if it was rejected.
+    // Caller:  chessIndex::indexGame(); main();
+    //
+    bool playMove(chessMove);
+    // Purpose: Plays a legal move, such as one found by chessSearch, without any console input or output.
+    //          The move is not validated again.
+    // Input:   chessMove move - The move to play.
+    // Output:  Returns FALSE if the game had already ended in checkmate or stalemate, TRUE once it is played.
+    // Caller:  chessGame::playNotation(); chessTournament::playGame();
+    //
+    void writeLine(const vector<chessMove>&, string*);
+    // Purpose: Writes a line of legal moves from the current position in SAN, numbered from 1 like a game
+    //          score, without playing it.
+    // Input:   const vector<chessMove>& line - The moves, such as a principal variation from chessSearch.
+    //          string* text - Receives the line, e.g. "1. e4 e5 2. Nf3" or "1... e5 2. Nf3".
+    // Output:  None.
+    // Caller:  main();
+    //
+    bool readMove(string_view, chessMove*);
+    // Purpose: Converts a move in SAN or coordinate notation into a legal move of the active player, without
+    //          playing it.
+    // Input:   string_view text - The move, e.g. "Nf3", "exd8=Q+", "O-O" or "e2e4".
+    //          chessMove* move - Receives the move.
+    // Output:  Returns TRUE if the text names exactly one legal move.
+    // Caller:  chessTestSuite::loadSuite();
+    //
+    void writeMove(chessMove, char*);
+    // Purpose: Writes a legal move of the active player in SAN, without playing it.
+    // Input:   chessMove move - The move.
+    //          char* san - Receives the SAN text and a terminating NUL (at least 10 characters).
+    // Output:  None.
+    // Caller:  chessTestSuite::printReport();
+    //
+    bool jumpToPly(int);
+    // Purpose: Brings back the position after any number of moves of the game, for reviewing it, taking moves
+    //          back or trying another line.  Moves played from there replace the ones that followed.  Costs
+    //          fewer than chessMoveLog::checkpointInterval replayed moves wherever the ply is.  Positions from
+    //          before the game was loaded from FEN no longer count for repetitions.
+    // Input:   int ply - Number of moves from the start of the game or the loaded position, 0 to getPlyCount().
+    // Output:  Returns FALSE if the ply is out of range.
+    // Caller:  chessGame::handleInput(); chessGame::loadSnapshot();
+    //
+    int getPlyCount();
+    // Purpose: Returns the number of moves logged, including any after the current ply.
+    // Input:   None.
+    // Output:  int plies - Number of moves.
+    // Caller:  None;
+    //
+    int getCurrentPly();
+    // Purpose: Returns the number of moves played to reach the current position.
+    // Input:   None.
+    // Output:  int ply - Number of moves.
+    // Caller:  chessGame::handleInput();
+    //
+    void getLegalMoves(vector<chessMove>*);
+    // Purpose: Lists every legal move of the active player, one per promotion piece.
+    // Input:   vector<chessMove>* moves - Receives the moves, appended to whatever it holds.
+    // Output:  None.
+    // Caller:  chessTournament::playOpening();
+    //
+    color getActivePlayer();
+    // Purpose: Returns the player whose turn it is.
+    // Input:   None.
+    // Output:  color activePlayer - WHITE or BLACK.
+    // Caller:  chessTournament::playGame();
+    //
+    void setupSearch(chessSearch*);
+    // Purpose: Gives a search the current position and the positions played before it.
+    // Input:   chessSearch* search - The search to set up.
+    // Output:  None.
+    // Caller:  chessTournament::playGame(); chessHint::analyze(); chessEngine;
+    //
+    void completeTurn();
+    // Purpose: Performs the validated move stored in moveFrom/moveTo, updates check and checkmate status, then
+    //          passes the turn to the opposing player.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::loopGameplay(); chessGame::replayMove();
+    //
+    bool loadPosition(string_view);
+    // Purpose: Replaces the game with a position given in FEN, without any console input or output.
+    // Input:   string_view fen - Piece placement, side to move, castling rights and en passant square.  The move
+    //          counters may be left out.
+    // Output:  Returns TRUE if the position was loaded. On FALSE the game is reset to the starting position.
+    // Caller:  main();
+    //
+    uint64_t perft(int, vector<string>*);
+    // Purpose: Counts the legal move sequences of a fixed length from the current position, to verify the move
+    //          generator, including castling, en passant and promotion, against published node counts.  The
+    //          first moves are counted in parallel on the shared chessThreadPool.
+    // Input:   int depth - Number of plies to count, at least 1.
+    //          vector<string>* divide - If not NULL, receives one "e2e4: 20" line per legal move of the position.
+    // Output:  uint64_t nodes - Number of move sequences of exactly that length.
+    // Caller:  main();
+    //
+    uint64_t getPositionHash();
+    // Purpose: Returns the Zobrist hash of the current board position and side to move.
+    // Input:   None.
+    // Output:  uint64_t hash - Hash of the current position.
+    // Caller:  chessIndex::indexGame(); main(); chessHint; chessEngine::chooseMove();
+    //
+    void saveSnapshot(string*);
+    // Purpose: Writes the complete state of the game as a compact binary snapshot: board, side to move, check,
+    //          game state, castling and en passant rights, the move being entered, the last action shown,
+    //          the position history, the move log, and the clock and engine settings.  The layout is versioned
+    //          and in native byte order.
+    // Input:   string* out - Receives the snapshot, appended to whatever it holds.
+    // Output:  None.
+    // Caller:  chessGame::handleInput();
+    //
+    bool loadSnapshot(string_view);
+    // Purpose: Restores a game written by saveSnapshot(), without any console input or output.
+    // Input:   string_view data - The snapshot.
+    // Output:  Returns FALSE if the data is not a valid snapshot; the game is then reset to the starting position.
+    //          Version 1 snapshots, saved without a move log, resume with a log that starts at their position.
+    //          Snapshots before version 3 resume without a clock or engine.
+    // Caller:  main();
+    //
+    gameState getGameState();
+    // Purpose: Returns the current state of the game (normal, error, check, checkmate, stalemate).
+    // Input:   None.
+    // Output:  gameState activeGameState - The current game state.
+    // Caller:  chessIndex::indexGame(); chessTournament::playGame();
+    //
+    void capturePiece(chessPieceType, chessPieceType, color);
+    // Purpose: When a player successfully lands their piece on an opposing player's piece, this function
+    //          properly notifies the user interface by adding data to the gameAction string variable.
+    // Input:   chessPieceType attackingPiece - The type of chess piece that is attacking.
+    //          chessPieceType capturedPiece -  The type of chess piece that is captured.
+    //          color c - Color of the piece that is attacking.
+    // Output:  None.
+    // Caller:  chessGame::doMove();
+    //
+    void startMoveLog();
+    // Purpose: Starts logging the moves of the game from the current position.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::resetGame(); chessGame::loadPosition(); chessGame::loadSnapshot();
+    //
+    void doMove(coordinates, coordinates);
+    // Purpose: Handles the logic for actually moving a chess piece on the virtual game board, including if an
+    //          opposing player's piece is captured during the movement process.  Castling, en passant and
+    //          promotion (to movePromotion, or a QUEEN) are carried out by chessLogic::makeMove().
+    // Input:   coordinates from - The starting x,y position of the move on the game board. 
+    //          coordinates to - The destination x,y position of where to move the piece on the game board.
+    // Output:  None.
+    // Caller:  chessGame::loopGameplay();
+    //
+    void endGame();
+    // Purpose: Handles the process of actually ending the game once a winner or stalemate is declared.
+    //          Prints the engine's performance counters for the game that ended.
+    // Input:   None.
+    // Output:  None.
+    // Caller: Main.activeGame
+    //
+    
+private:
+    enum inputStage{AWAIT_START, AWAIT_DESTINATION};
+    // The two steps of entering a move.
+    
+    chessLogic clogic;
+    // Holds instance of a chessLogic object that governs game play mechanics.
+    chessInterface cinterface;
+    // Holds instance of a chessInterface object that handles on screen output / user interface.
+    chessTile chessBoard[8][8] = {};
+    // Virtual representation of the 8x8 standard chess board.
+    chessNotation cnotation;
+    // Holds instance of a chessNotation object that reads and writes moves in SAN.
+    coordinates moveFrom, moveTo;
+    // Represents a player's inputted desired move.
+    chessPieceType movePromotion = NOPIECE;
+    // Piece a pawn is promoted to by the inputted move, NOPIECE if none.
+    boardRights positionRights = {WHITE_KINGSIDE | WHITE_QUEENSIDE | BLACK_KINGSIDE | BLACK_QUEENSIDE, {-1, -1}, 0};
+    // Castling rights still held, the current en passant square and the halfmove clock.
+    chessHistory history;
+    // Hashes of the positions of this game, for the repetition and fifty-move rules.
+    color activePlayer = WHITE;
+    // Holds the value of which player's turn is currently active.
+    color playerInCheck = NONE;
+    // Holds the value of which if any player is currently in 'Check'.
+    gameState activeGameState = NORMALPLAY;
+    // Holds the value of the state of the game, whether the game is normal, error, check, checkmate, stalemate or drawn.
+    string lastMove;
+    // Holds data of the last inputted move, in Standard Algebraic Notation
+    string gameAction = "New Game Started. White Moves First.";
+    // Holds relevant data to the last gameplay action.
+    inputStage inputStep = AWAIT_START;
+    // Which coordinates the next line of input is expected to hold.
+    function<void()> idleTask;
+    // Work to run while waiting for player input, if any.
+    chessInput* inputSource = NULL;
+    // Line reader shared with the caller, NULL to read standard input directly.
+    unique_ptr<chessHint> hintEngine;
+    // Background analysis behind the "hint" command, only running inside loopGameplay() of a two player game.
+    color engineSide = NONE;
+    // The side played by the engine, NONE if both are human.
+    searchLimits engineLimits = {0, 400000};
+    // Depth and node limits of each engine move.
+    bool isEnginePondering = true;
+    // Whether the engine searches on the player's time.
+    unique_ptr<chessEngine> engine;
+    // The engine playing engineSide, only running inside loopGameplay().
+    chessClock gameClock;
+    // Time left for both players, disabled unless setClock() gave a base time.
+    chessEventStream* eventStream = NULL;
+    // Stream the game's events are reported to, NULL if none.
+    chessMoveLog moveLog;
+    // Every move of the game with board checkpoints, for jumpToPly().
+    int currentPly = 0;
+    // Ply of the current position in moveLog.
+};
+
+#endif /* CHESSGAME_H */
+
@@ -0,0 +1,121 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessHash.cpp
+ *      Purpose: Computes 64-bit Zobrist position hashes for the 8x8 chess board.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ *
+ */
+
+#include "chessHash.h"
+
+namespace {
+
+    // table of random keys, one per piece type/color/square plus the side to move
+    struct zobristKeys {
+        uint64_t pieces[2][6][64];
+        uint64_t side;
+        uint64_t castling[16];
+        uint64_t enPassant[8];
+    };
+
+    // splitmix64 step, used to fill the key table with well mixed values at compile time
+    constexpr uint64_t nextKey(uint64_t& state){
+        state += 0x9E3779B97F4A7C15ULL;
+        uint64_t z = state;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    constexpr zobristKeys generateKeys(){
+        zobristKeys keys = {};
+        uint64_t state = 0x2350C0FFEE2019ULL;
+        for(int c = 0; c < 2; c++){
+            for(int p = 0; p < 6; p++){
+                for(int sq = 0; sq < 64; sq++){
+                    keys.pieces[c][p][sq] = nextKey(state);
+                }
+            }
+        }
+        keys.side = nextKey(state);
+        // generated after the older keys so those keep their values
+        for(int r = 1; r < 16; r++){
+            keys.castling[r] = nextKey(state);
+        }
+        for(int f = 0; f < 8; f++){
+            keys.enPassant[f] = nextKey(state);
+        }
+        return keys;
+    }
+
+    constexpr zobristKeys zobrist = generateKeys();
+}
+
+// hashes every occupied tile on the board, then the side to move
+uint64_t chessHash::hashBoard(chessTile (*ptr)[8][8], color sideToMove, boardRights* rights){
+    uint64_t hash = 0;
+    pieceData piece;
+    for(int i = 0; i < 8; i++){
+        for(int j = 0; j < 8; j++){
+            piece = (*ptr)[i][j].getActivePiece();
+            if(piece.pieceType != NOPIECE && piece.pieceColor != NONE){
+                hash ^= getPieceKey(piece.pieceType, piece.pieceColor, {i,j});
+            }
+        }
+    }
+    if(sideToMove == BLACK){
+        hash ^= getSideKey();
+    }
+    if(rights == NULL){
+        return hash;
+    }
+    hash ^= getCastlingKey(rights->castling);
+    
+    // the en passant square only makes a different position if a pawn can actually capture onto it
+    coordinates ep = rights->enPassant;
+    if(ep.posX >= 0){
+        int pawnRow = ep.posX + ((sideToMove == WHITE) ? 1 : -1);
+        for(int y = ep.posY - 1; y <= ep.posY + 1; y += 2){
+            if(y >= 0 && y < 8 && pawnRow >= 0 && pawnRow < 8){
+                piece = (*ptr)[pawnRow][y].getActivePiece();
+                if(piece.pieceType == PAWN && piece.pieceColor == sideToMove){
+                    hash ^= getEnPassantKey(ep.posY);
+                    break;
+                }
+            }
+        }
+    }
+    return hash;
+}
+
+uint64_t chessHash::hashPawns(chessTile (*ptr)[8][8]){
+    uint64_t hash = 0;
+    for(int i = 0; i < 8; i++){
+        for(int j = 0; j < 8; j++){
+            pieceData piece = (*ptr)[i][j].getActivePiece();
+            if(piece.pieceType == PAWN){
+                hash ^= getPieceKey(PAWN, piece.pieceColor, {i,j});
+            }
+        }
+    }
+    return hash;
+}
+
+uint64_t chessHash::getPieceKey(chessPieceType p, color c, coordinates coords){
+    return zobrist.pieces[c][p][coords.posX * 8 + coords.posY];
+}
+
+uint64_t chessHash::getSideKey(){
+    return zobrist.side;
+}
+
+uint64_t chessHash::getCastlingKey(int castling){
+    return zobrist.castling[castling & 15];
+}
+
+uint64_t chessHash::getEnPassantKey(int file){
+    return zobrist.enPassant[file];
+}
@@ -0,0 +1,70 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessHash.h
+ *      Purpose: Computes 64-bit Zobrist position hashes for the 8x8 chess board. Keys are generated at compile
+ *               time, so identical positions hash identically across runs, builds and saved index files.
+ *               Castling rights and a usable en passant capture are part of the position, as they are for
+ *               the repetition rule.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ *
+ */
+
+#ifndef CHESSHASH_H
+#define CHESSHASH_H
+#include <cstdlib>
+#include <cstdint>
+#include "globals.h"
+#include "chessTile.h"
+
+using namespace std;
+
+class chessHash {
+public:
+    static uint64_t hashBoard(chessTile (*ptr)[8][8], color, boardRights*);
+    // Purpose: Computes the full Zobrist hash of a board position from scratch.
+    // Input:   chessTile (*ptr)[8][8] - Reference to the 8x8 chessBoard to hash.
+    //          color sideToMove - The player whose turn it is in this position.
+    //          boardRights* rights - Castling rights and en passant square, or NULL if there are none. The en
+    //          passant square only counts when a pawn of the side to move stands ready to capture onto it.
+    // Output:  uint64_t hash - The position hash.
+    // Caller:  chessGame::getPositionHash();
+    //
+    static uint64_t hashPawns(chessTile (*ptr)[8][8]);
+    // Purpose: Computes the Zobrist hash of the pawns of a position alone, from the same keys as hashBoard().
+    // Input:   chessTile (*ptr)[8][8] - Reference to the 8x8 chessBoard to hash.
+    // Output:  uint64_t hash - The pawn hash, 0 without pawns.
+    // Caller:  chessSearch::setPosition();
+    //
+    static uint64_t getPieceKey(chessPieceType, color, coordinates);
+    // Purpose: Returns the key for a single piece standing on a single square, used for incremental updates.
+    // Input:   chessPieceType p - Type of the piece (PAWN through KING).
+    //          color c - Color of the piece (WHITE or BLACK).
+    //          coordinates coords - X,Y position of the piece.
+    // Output:  uint64_t key - The Zobrist key of that piece/square pair.
+    // Caller:  chessHash::hashBoard(); chessSearch::playMove();
+    //
+    static uint64_t getSideKey();
+    // Purpose: Returns the key that is mixed into the hash when BLACK is the side to move.
+    // Input:   None.
+    // Output:  uint64_t key - The side to move key.
+    // Caller:  chessHash::hashBoard();
+    //
+    static uint64_t getCastlingKey(int);
+    // Purpose: Returns the key for a set of castling rights. No rights have the key 0.
+    // Input:   int castling - castlingRight flags.
+    // Output:  uint64_t key - The castling key.
+    // Caller:  chessHash::hashBoard();
+    //
+    static uint64_t getEnPassantKey(int);
+    // Purpose: Returns the key for an en passant capture being possible on a file.
+    // Input:   int file - Board column of the en passant square, 0-7.
+    // Output:  uint64_t key - The en passant key.
+    // Caller:  chessHash::hashBoard();
+    //
+};
+
+#endif /* CHESSHASH_H */
+
@@ -0,0 +1,95 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessHint.cpp
+ *      Purpose: Background analysis thread behind the "hint" command.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ *
+ */
+
+#include "chessHint.h"
+#include "chessGame.h"
+
+namespace {
+    const searchLimits hintLimits = {64, 200000000};
+    // how far one position is analysed before the thread goes idle: deep enough never to stop while a player
+    // is thinking, but not burning a core forever in front of an abandoned game
+    const int stopPollInterval = 1;
+    // milliseconds analyze() waits between requests to stop the running search
+}
+
+chessHint::chessHint() {
+    search.setReporter([this](const searchResult& result){ report(result); });
+    worker = thread(&chessHint::analysisLoop, this);
+}
+
+chessHint::~chessHint(){
+    {
+        unique_lock<mutex> guard(lock);
+        isQuitting = true;
+        while(isSearching){
+            search.stop();
+            wakeUp.wait_for(guard, chrono::milliseconds(stopPollInterval));
+        }
+    }
+    wakeUp.notify_all();
+    worker.join();
+}
+
+void chessHint::analyze(chessGame* game){
+    uint64_t hash = game->getPositionHash();
+    unique_lock<mutex> guard(lock);
+    if(hash == positionHash && (isPending || isSearching || hasResult)){
+        return;
+    }
+
+    // the search has to be idle before its position is replaced. A stop can be missed while the thread is
+    // just starting a search, so it is asked again until the search returns.
+    while(isSearching){
+        search.stop();
+        wakeUp.wait_for(guard, chrono::milliseconds(stopPollInterval));
+    }
+    game->setupSearch(&search);
+    positionHash = hash;
+    hasResult = false;
+    isPending = true;
+    guard.unlock();
+    wakeUp.notify_all();
+}
+
+bool chessHint::getHint(uint64_t hash, searchResult* result){
+    lock_guard<mutex> guard(lock);
+    if(!hasResult || hash != positionHash){
+        return false;
+    }
+    *result = bestResult;
+    return true;
+}
+
+void chessHint::analysisLoop(){
+    unique_lock<mutex> guard(lock);
+    for(;;){
+        wakeUp.wait(guard, [this]{ return isPending || isQuitting; });
+        if(isQuitting){
+            return;
+        }
+        isPending = false;
+        isSearching = true;
+        guard.unlock();
+        search.search(hintLimits);
+        guard.lock();
+        isSearching = false;
+        wakeUp.notify_all();
+    }
+}
+
+void chessHint::report(const searchResult& result){
+    // the position only changes while the search is idle, so every result is for the current one
+    lock_guard<mutex> guard(lock);
+    if(result.bestMove.from.posX >= 0){
+        bestResult = result;
+        hasResult = true;
+    }
+}
@@ -0,0 +1,97 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessHint.h
+ *      Purpose: Background analysis for the "hint" command of a two player game.  A thread of its own searches
+ *               the position on the board for as long as it stays there, deepening one iteration at a time, and
+ *               keeps the result of the last completed iteration.  Asking for a hint only reads that result, so
+ *               it returns at once no matter how long the search has been running.
+ *      Input: The game whose position to analyse, see analyze().
+ *      Output: The best move found so far, see getHint().
+ *      Exceptions: None.
+ *
+ */
+
+#ifndef CHESSHINT_H
+#define CHESSHINT_H
+#include <cstdlib>
+#include <cstdint>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "globals.h"
+#include "chessSearch.h"
+
+using namespace std;
+
+class chessGame;
+
+class chessHint {
+public:
+    chessHint();
+    // Purpose: Starts the analysis thread, idle until a position is given to analyze().
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::loopGameplay();
+    //
+    ~chessHint();
+    // Purpose: Stops the analysis and joins the thread.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  None;
+    //
+    void analyze(chessGame*);
+    // Purpose: Makes the game's current position the one being analysed.  Does nothing if it already is, so it
+    //          can be called whenever the position might have changed.  An analysis of an earlier position is
+    //          stopped and its result forgotten.
+    // Input:   chessGame* game - The game. Only read during the call.
+    // Output:  None.
+    // Caller:  chessGame::loopGameplay();
+    //
+    bool getHint(uint64_t, searchResult*);
+    // Purpose: Returns the result of the deepest iteration completed so far for a position, without waiting.
+    // Input:   uint64_t positionHash - Hash of the position the hint is for, from chessGame::getPositionHash().
+    //          searchResult* result - Receives the best move, its score and the depth it was found at.
+    // Output:  Returns FALSE if that position is not being analysed or no iteration has completed yet.
+    // Caller:  chessGame::handleInput();
+    //
+
+private:
+    void analysisLoop();
+    // Purpose: Body of the analysis thread: waits for a position, searches it until it is replaced or the
+    //          limits are reached, and repeats.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessHint::chessHint();
+    //
+    void report(const searchResult&);
+    // Purpose: Keeps the result of a completed iteration of the position being analysed.
+    // Input:   const searchResult& result - The result.
+    // Output:  None.
+    // Caller:  chessSearch::search(), through its reporter;
+    //
+
+    chessSearch search;
+    // The search run by the analysis thread. Its position is only set while it is not searching.
+    thread worker;
+    // The analysis thread.
+    mutex lock;
+    // Guards every member below.
+    condition_variable wakeUp;
+    // Signals the thread that there is a new position, or that it has to quit, and the caller of analyze()
+    // that the search has stopped.
+    uint64_t positionHash = 0;
+    // Hash of the position being analysed.
+    bool isPending = false;
+    // Set when a new position waits to be searched.
+    bool isSearching = false;
+    // Set while the thread is inside search().
+    bool isQuitting = false;
+    // Set by the destructor.
+    bool hasResult = false;
+    // Set once an iteration of the current analysis has completed.
+    searchResult bestResult = {};
+    // Result of the deepest completed iteration of the current analysis.
+};
+
+#endif /* CHESSHINT_H */
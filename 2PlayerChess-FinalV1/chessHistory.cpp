@@ -0,0 +1,100 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessHistory.cpp
+ *      Purpose: Ring of position hashes for the repetition and fifty-move draw rules.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ *
+ */
+
+#include "chessHistory.h"
+#include <cstring>
+
+void chessHistory::clear(){
+    count = 0;
+}
+
+void chessHistory::push(uint64_t hash, int halfmoveClock){
+    hashes[count & (historySize - 1)] = hash;
+    clocks[count & (historySize - 1)] = halfmoveClock;
+    count++;
+}
+
+void chessHistory::pop(){
+    if(count > 0){
+        count--;
+    }
+}
+
+uint64_t chessHistory::getLatestHash(){
+    return (count > 0) ? hashes[(count - 1) & (historySize - 1)] : 0;
+}
+
+int chessHistory::countRepetitions(){
+    if(count == 0){
+        return 0;
+    }
+    int last = count - 1;
+    uint64_t hash = hashes[last & (historySize - 1)];
+    
+    // only positions since the last irreversible move can match, and only with the same side to move
+    int reach = clocks[last & (historySize - 1)];
+    reach = (reach < last) ? reach : last;
+    reach = (reach < historySize - 1) ? reach : historySize - 1;
+    
+    int repetitions = 0;
+    for(int i = 4; i <= reach; i += 2){
+        if(hashes[(last - i) & (historySize - 1)] == hash){
+            repetitions++;
+        }
+    }
+    return repetitions;
+}
+
+bool chessHistory::isRepeated(){
+    return countRepetitions() > 0;
+}
+
+bool chessHistory::isThreefold(){
+    return countRepetitions() >= 2;
+}
+
+bool chessHistory::isFiftyMoveDraw(){
+    return count > 0 && clocks[(count - 1) & (historySize - 1)] >= 100;
+}
+
+void chessHistory::save(string* out){
+    // total positions pushed, then the ones still in the ring with their clocks, in native byte order
+    int32_t header[2] = {count, (count < historySize) ? count : historySize};
+    out->append(reinterpret_cast<const char*>(header), sizeof(header));
+    for(int i = count - header[1]; i < count; i++){
+        int32_t clock = clocks[i & (historySize - 1)];
+        out->append(reinterpret_cast<const char*>(&hashes[i & (historySize - 1)]), sizeof(uint64_t));
+        out->append(reinterpret_cast<const char*>(&clock), sizeof(clock));
+    }
+}
+
+bool chessHistory::load(string_view* data){
+    const size_t entrySize = sizeof(uint64_t) + sizeof(int32_t);
+    int32_t header[2];
+    count = 0;
+    if(data->size() < sizeof(header)){
+        return false;
+    }
+    memcpy(header, data->data(), sizeof(header));
+    if(header[1] < 0 || header[1] > historySize || header[0] < header[1] || data->size() < sizeof(header) + header[1] * entrySize){
+        return false;
+    }
+    data->remove_prefix(sizeof(header));
+    for(int i = header[0] - header[1]; i < header[0]; i++){
+        int32_t clock;
+        memcpy(&hashes[i & (historySize - 1)], data->data(), sizeof(uint64_t));
+        memcpy(&clock, data->data() + sizeof(uint64_t), sizeof(clock));
+        clocks[i & (historySize - 1)] = clock;
+        data->remove_prefix(entrySize);
+    }
+    count = header[0];
+    return true;
+}
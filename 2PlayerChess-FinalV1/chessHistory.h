@@ -0,0 +1,102 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessHistory.h
+ *      Purpose: Keeps the hashes of the positions of one game, for the repetition and fifty-move draw rules.
+ *               Hashes are stored in a fixed ring along with the halfmove clock of each position.  A position
+ *               can only repeat one reached since the last capture or pawn move, so a repetition test only looks
+ *               back over those reversible plies, every second one, and never walks the whole game.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ *
+ */
+
+#ifndef CHESSHISTORY_H
+#define CHESSHISTORY_H
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "globals.h"
+
+using namespace std;
+
+class chessHistory {
+public:
+    void clear();
+    // Purpose: Forgets every position, for the start of a new game.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::resetGame(); chessGame::loadPosition();
+    //
+    void push(uint64_t, int);
+    // Purpose: Adds the position reached by the last move.
+    // Input:   uint64_t hash - Hash of the position, see chessHash::hashBoard().
+    //          int halfmoveClock - Plies since the last capture or pawn move, 0 if the move was one.
+    // Output:  None.
+    // Caller:  chessGame::completeTurn(); chessGame::resetGame(); chessGame::loadPosition();
+    //
+    void pop();
+    // Purpose: Removes the latest position again, when a move is taken back.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  None;
+    //
+    uint64_t getLatestHash();
+    // Purpose: Returns the hash of the latest position.
+    // Input:   None.
+    // Output:  uint64_t hash - The hash, 0 if the history is empty.
+    // Caller:  chessSearch::alphaBeta(); chessSearch::readLine();
+    //
+    int countRepetitions();
+    // Purpose: Counts the earlier occurrences of the latest position.
+    // Input:   None.
+    // Output:  Returns the number of times the latest position was reached before, 0 if it is new.
+    // Caller:  chessHistory::isRepeated(); chessHistory::isThreefold();
+    //
+    bool isRepeated();
+    // Purpose: Checks whether the latest position occurred before at all.  A search can score such a position
+    //          as a draw straight away, since the side that repeated it could repeat it again.
+    // Input:   None.
+    // Output:  Returns TRUE if the position is a repetition.
+    // Caller:  None;
+    //
+    bool isThreefold();
+    // Purpose: Checks whether the latest position has now occurred three times.
+    // Input:   None.
+    // Output:  Returns TRUE if the game is drawn by repetition.
+    // Caller:  chessGame::completeTurn();
+    //
+    bool isFiftyMoveDraw();
+    // Purpose: Checks whether fifty moves by each side have passed without a capture or pawn move.
+    // Input:   None.
+    // Output:  Returns TRUE if the game is drawn by the fifty-move rule.
+    // Caller:  chessGame::completeTurn();
+    //
+    void save(string*);
+    // Purpose: Appends the positions still held in the ring, oldest first, in binary form.
+    // Input:   string* out - Receives the data.
+    // Output:  None.
+    // Caller:  chessGame::saveSnapshot();
+    //
+    bool load(string_view*);
+    // Purpose: Replaces the history with data written by save().
+    // Input:   string_view* data - The data. The bytes read are removed from its front.
+    // Output:  Returns FALSE if the data is cut short or inconsistent; the history is then empty.
+    // Caller:  chessGame::loadSnapshot();
+    //
+    
+private:
+    static const int historySize = 256;
+    // Number of positions kept, a power of two.  More than the 100 reversible plies the fifty-move rule
+    // allows, so every position that can still repeat is always in the ring.
+    uint64_t hashes[historySize] = {};
+    // Hashes of the latest positions, stored at their ply number modulo historySize.
+    int clocks[historySize] = {};
+    // Halfmove clock of each stored position.
+    int count = 0;
+    // Number of positions pushed since the last clear().
+};
+
+#endif /* CHESSHISTORY_H */
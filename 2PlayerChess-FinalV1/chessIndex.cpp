@@ -0,0 +1,327 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessIndex.cpp
+ *      Purpose: Builds and queries an on-disk index from position hash to (game id, ply) over a whole archive.
+ *      Input: Archive text file, one game per line, moves given in SAN or as coordinate pairs (e.g. "e4 e5 Nf3").
+ *      Output: Binary index file of sorted indexRecord entries behind a small header.
+ *      Exceptions: File errors are reported through the return values of buildIndex() and findPosition().
+ *
+ */
+
+#include "chessIndex.h"
+#include <algorithm>
+#include <cstdio>
+#include <queue>
+#include "chessThreadPool.h"
+
+namespace {
+
+    const char indexMagic[4] = {'C', 'H', 'I', 'X'};
+    const uint32_t indexVersion = 2;
+    // version 2: position hashes include castling rights and the en passant file
+    const size_t indexHeaderSize = 16;
+    // header layout: 4 byte magic, 4 byte version, 8 byte record count, followed by the sorted records
+
+    const size_t indexBatchSize = 256;
+    // number of archive lines a worker takes from the shared stream at a time
+    const size_t mergeBufferRecords = 4096;
+    // records buffered per run while merging
+    const size_t maxMergeWidth = 64;
+    // most runs merged at once, each holding a file descriptor open
+
+    bool recordLess(const indexRecord& a, const indexRecord& b){
+        if(a.hash != b.hash){
+            return a.hash < b.hash;
+        }
+        if(a.gameId != b.gameId){
+            return a.gameId < b.gameId;
+        }
+        return a.ply < b.ply;
+    }
+
+    // buffered sequential reader over a single sorted run file
+    struct runReader {
+        ifstream file;
+        vector<indexRecord> buffer;
+        size_t position = 0;
+
+        bool refill(){
+            buffer.resize(mergeBufferRecords);
+            file.read(reinterpret_cast<char*>(buffer.data()), buffer.size() * sizeof(indexRecord));
+            buffer.resize(file.gcount() / sizeof(indexRecord));
+            position = 0;
+            return !buffer.empty();
+        }
+    };
+}
+
+chessIndex::chessIndex() {
+    threadCount = chessThreadPool::getShared().getConcurrency();
+    memoryBudget = 64 * 1024 * 1024;
+    nextGameId = 0;
+    gamesRejected = 0;
+    recordCount = 0;
+    runFailed = false;
+}
+
+void chessIndex::setThreadCount(int count){
+    threadCount = (count < 1) ? 1 : count;
+}
+
+void chessIndex::setMemoryBudget(size_t bytes){
+    memoryBudget = bytes;
+}
+
+bool chessIndex::buildIndex(string archivePath, string indexPath){
+    archive.open(archivePath);
+    if(!archive.is_open()){
+        return false;
+    }
+
+    // reset state left over from a previous build
+    nextGameId = 0;
+    gamesRejected = 0;
+    recordCount = 0;
+    runFailed = false;
+    runFiles.clear();
+    runPrefix = indexPath + ".run";
+
+    // replay and sort in parallel on the shared pool, each worker spilling its own runs
+    chessThreadPool& pool = chessThreadPool::getShared();
+    chessTaskGroup workers;
+    for(int i = 0; i < threadCount; i++){
+        pool.submit(&workers, [this](){ indexWorker(); });
+    }
+    pool.wait(&workers);
+    archive.close();
+
+    if(runFailed){
+        for(int i = 0; i < runFiles.size(); i++){
+            remove(runFiles.at(i).c_str());
+        }
+        return false;
+    }
+    return mergeRuns(indexPath);
+}
+
+void chessIndex::indexWorker(){
+    chessGame game;
+    vector<string> batch;
+    vector<indexRecord> run;
+    uint32_t firstId;
+    size_t runCapacity = memoryBudget / (threadCount * sizeof(indexRecord));
+    if(runCapacity < 1024){
+        runCapacity = 1024;
+    }
+    run.reserve(runCapacity);
+
+    while(readGameBatch(&batch, &firstId)){
+        for(int i = 0; i < batch.size(); i++){
+            if(!indexGame(&game, firstId + i, batch.at(i), &run)){
+                lock_guard<mutex> lock(archiveLock);
+                gamesRejected++;
+            }
+            // spill once the run buffer reaches this worker's share of the memory budget
+            if(run.size() >= runCapacity - 512){
+                if(!writeRun(&run)){
+                    return;
+                }
+            }
+        }
+    }
+    if(!run.empty()){
+        writeRun(&run);
+    }
+}
+
+bool chessIndex::readGameBatch(vector<string>* batch, uint32_t* firstId){
+    lock_guard<mutex> lock(archiveLock);
+    string line;
+    batch->clear();
+    *firstId = nextGameId;
+    while(batch->size() < indexBatchSize && getline(archive, line)){
+        // blank lines and '#' comments are not games and do not use up a game id
+        if(line.empty() || line[0] == '#' || line[0] == '\r'){
+            continue;
+        }
+        batch->push_back(line);
+        nextGameId++;
+    }
+    return !batch->empty();
+}
+
+bool chessIndex::indexGame(chessGame* game, uint32_t gameId, const string& moves, vector<indexRecord>* run){
+    string_view text = moves;
+    string_view token;
+    uint32_t ply = 0;
+
+    // the first ply of every game is the standard starting position
+    game->resetGame();
+    run->push_back({game->getPositionHash(), gameId, ply});
+
+    while(chessNotation::nextMoveToken(&text, &token)){
+        if(!game->playNotation(token, NULL)){
+            return false;
+        }
+        ply++;
+        run->push_back({game->getPositionHash(), gameId, ply});
+    }
+    return true;
+}
+
+bool chessIndex::writeRun(vector<indexRecord>* run){
+    sort(run->begin(), run->end(), recordLess);
+
+    string path;
+    {
+        lock_guard<mutex> lock(runLock);
+        path = runPrefix + to_string(runFiles.size());
+        runFiles.push_back(path);
+    }
+
+    ofstream file(path, ios::binary | ios::trunc);
+    file.write(reinterpret_cast<const char*>(run->data()), run->size() * sizeof(indexRecord));
+    run->clear();
+    if(!file){
+        lock_guard<mutex> lock(runLock);
+        runFailed = true;
+        return false;
+    }
+    return true;
+}
+
+bool chessIndex::mergeRuns(string indexPath){
+    // a merge keeps every one of its runs open, so a large archive's runs are first merged in groups into
+    // longer runs until few enough are left to stay well within the process's file descriptor limit
+    bool isValid = true;
+    size_t nextRun = runFiles.size();
+    while(runFiles.size() > maxMergeWidth){
+        vector<string> mergedRuns;
+        for(size_t first = 0; first < runFiles.size(); first += maxMergeWidth){
+            vector<string> group(runFiles.begin() + first, runFiles.begin() + min(first + maxMergeWidth, runFiles.size()));
+            string path = runPrefix + to_string(nextRun++);
+            ofstream run(path, ios::binary | ios::trunc);
+            uint64_t count = 0;
+            isValid = mergeGroup(group, (isValid && run.is_open()) ? &run : NULL, &count) && isValid;
+            mergedRuns.push_back(path);
+        }
+        runFiles = mergedRuns;
+    }
+
+    ofstream out(indexPath, ios::binary | ios::trunc);
+    // the record count is patched into the header once the merge is finished
+    uint64_t count = 0;
+    out.write(indexMagic, 4);
+    out.write(reinterpret_cast<const char*>(&indexVersion), sizeof(indexVersion));
+    out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    isValid = mergeGroup(runFiles, (isValid && out.is_open()) ? &out : NULL, &count) && isValid;
+    runFiles.clear();
+    if(!isValid){
+        return false;
+    }
+    out.seekp(8);
+    out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    recordCount = count;
+    return out.good();
+}
+
+bool chessIndex::mergeGroup(const vector<string>& runs, ofstream* out, uint64_t* count){
+    vector<runReader> readers(runs.size());
+    bool isValid = (out != NULL);
+    for(int i = 0; isValid && i < runs.size(); i++){
+        readers.at(i).file.open(runs.at(i), ios::binary);
+        if(!readers.at(i).file.is_open()){
+            isValid = false;
+        }
+    }
+
+    // min-heap of (record, run) pairs, always holding the smallest unmerged record of each run
+    auto greater = [](const pair<indexRecord, int>& a, const pair<indexRecord, int>& b){
+        return recordLess(b.first, a.first);
+    };
+    priority_queue<pair<indexRecord, int>, vector<pair<indexRecord, int> >, decltype(greater)> heap(greater);
+    for(int i = 0; isValid && i < readers.size(); i++){
+        if(readers.at(i).refill()){
+            heap.push(make_pair(readers.at(i).buffer.at(0), i));
+        }
+    }
+
+    vector<indexRecord> output;
+    output.reserve(mergeBufferRecords);
+    while(isValid && !heap.empty()){
+        pair<indexRecord, int> next = heap.top();
+        heap.pop();
+        output.push_back(next.first);
+        (*count)++;
+        if(output.size() == mergeBufferRecords){
+            out->write(reinterpret_cast<const char*>(output.data()), output.size() * sizeof(indexRecord));
+            output.clear();
+        }
+        runReader* reader = &readers.at(next.second);
+        reader->position++;
+        if(reader->position < reader->buffer.size() || reader->refill()){
+            heap.push(make_pair(reader->buffer.at(reader->position), next.second));
+        }
+    }
+    if(isValid){
+        out->write(reinterpret_cast<const char*>(output.data()), output.size() * sizeof(indexRecord));
+        isValid = out->good();
+    }
+
+    for(int i = 0; i < readers.size(); i++){
+        readers.at(i).file.close();
+        remove(runs.at(i).c_str());
+    }
+    return isValid;
+}
+
+vector<indexRecord> chessIndex::findPosition(string indexPath, uint64_t hash){
+    vector<indexRecord> matches;
+    ifstream file(indexPath, ios::binary);
+    char magic[4];
+    uint32_t version;
+    uint64_t count;
+
+    file.read(magic, 4);
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&count), sizeof(count));
+    if(!file || !equal(magic, magic + 4, indexMagic) || version != indexVersion){
+        return matches;
+    }
+
+    // binary search for the first record with a matching hash
+    indexRecord record;
+    uint64_t low = 0, high = count;
+    while(low < high){
+        uint64_t mid = low + (high - low) / 2;
+        file.seekg(indexHeaderSize + mid * sizeof(indexRecord));
+        file.read(reinterpret_cast<char*>(&record), sizeof(record));
+        if(record.hash < hash){
+            low = mid + 1;
+        }
+        else{
+            high = mid;
+        }
+    }
+
+    // matching records are stored contiguously from there on
+    file.seekg(indexHeaderSize + low * sizeof(indexRecord));
+    while(low < count && file.read(reinterpret_cast<char*>(&record), sizeof(record)) && record.hash == hash){
+        matches.push_back(record);
+        low++;
+    }
+    return matches;
+}
+
+uint32_t chessIndex::getGamesIndexed(){
+    return nextGameId;
+}
+
+uint32_t chessIndex::getGamesRejected(){
+    return gamesRejected;
+}
+
+uint64_t chessIndex::getRecordCount(){
+    return recordCount;
+}
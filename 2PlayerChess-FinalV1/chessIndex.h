@@ -0,0 +1,153 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessIndex.h
+ *      Purpose: Builds and queries an on-disk index from position hash to (game id, ply) over a whole archive of
+ *               games, answering "which games reached this position" without replaying the archive.
+ *               The index is built with a parallel external sort: worker tasks on the shared thread pool replay games through chessGame,
+ *               sort fixed size runs in memory and spill them to disk, then the runs are merged into one file.
+ *      Input: Archive text file, one game per line, moves given in SAN or as coordinate pairs (e.g. "e4 e5 Nf3" or
+ *             "e2e4 e7e5 g1f3").  Move numbers ("1.") and results ("1-0") are skipped.
+ *      Output: Binary index file of sorted indexRecord entries behind a small header.
+ *      Exceptions: File errors are reported through the return values of buildIndex() and findPosition().
+ *
+ */
+
+#ifndef CHESSINDEX_H
+#define CHESSINDEX_H
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <mutex>
+#include "globals.h"
+#include "chessGame.h"
+
+using namespace std;
+
+struct indexRecord {uint64_t hash; uint32_t gameId; uint32_t ply;};
+// One entry of the position index: the position hash, the archive game it occurred in and the ply it occurred at.
+
+class chessIndex {
+public:
+    chessIndex();
+    // Purpose: Default constructor. Uses every available core and a 64MB in-memory sort budget.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  main();
+    //
+    void setThreadCount(int);
+    // Purpose: Sets the number of worker tasks used to replay and sort games when building an index.  No more
+    //          run at once than the shared chessThreadPool has threads.
+    // Input:   int count - Number of worker tasks, at least 1.
+    // Output:  None.
+    // Caller:  main();
+    //
+    void setMemoryBudget(size_t);
+    // Purpose: Sets the total memory the workers may use for in-memory runs before spilling them to disk.
+    // Input:   size_t bytes - Memory budget in bytes, shared evenly between all workers.
+    // Output:  None.
+    // Caller:  main();
+    //
+    bool buildIndex(string, string);
+    // Purpose: Replays every game in the archive and writes the sorted position index.
+    // Input:   string archivePath - Path of the archive text file to index.
+    //          string indexPath - Path of the index file to create. Temporary runs are written next to it.
+    // Output:  Returns TRUE if the index was written, FALSE if a file could not be opened or written.
+    // Caller:  main();
+    //
+    vector<indexRecord> findPosition(string, uint64_t);
+    // Purpose: Looks up every occurrence of a position hash with a binary search over the index file.
+    // Input:   string indexPath - Path of an index file written by buildIndex().
+    //          uint64_t hash - Position hash to look up, see chessGame::getPositionHash().
+    // Output:  Returns all matching records ordered by game id and ply. Empty if none or on file error.
+    // Caller:  main();
+    //
+    uint32_t getGamesIndexed();
+    // Purpose: Returns the number of games read from the archive by the last buildIndex() call.
+    // Input:   None.
+    // Output:  uint32_t gamesIndexed - Number of games indexed.
+    // Caller:  main();
+    //
+    uint32_t getGamesRejected();
+    // Purpose: Returns the number of games that contained an unreadable or illegal move during the last build.
+    //          Positions up to the rejected move are still indexed.
+    // Input:   None.
+    // Output:  uint32_t gamesRejected - Number of games that stopped early.
+    // Caller:  main();
+    //
+    uint64_t getRecordCount();
+    // Purpose: Returns the number of records written by the last buildIndex() call.
+    // Input:   None.
+    // Output:  uint64_t recordCount - Total number of indexed positions.
+    // Caller:  main();
+    //
+
+private:
+    void indexWorker();
+    // Purpose: Worker task. Pulls batches of games from the archive, replays them and spills sorted runs.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessIndex::buildIndex();
+    //
+    bool readGameBatch(vector<string>*, uint32_t*);
+    // Purpose: Reads the next batch of game lines from the shared archive stream.
+    // Input:   vector<string>* batch - Filled with up to indexBatchSize game lines.
+    //          uint32_t* firstId - Set to the game id of the first line in the batch.
+    // Output:  Returns FALSE once the archive is exhausted.
+    // Caller:  chessIndex::indexWorker();
+    //
+    bool indexGame(chessGame*, uint32_t, const string&, vector<indexRecord>*);
+    // Purpose: Replays one game from the starting position and appends a record for every position reached.
+    // Input:   chessGame* game - Headless game instance owned by the calling worker.
+    //          uint32_t gameId - Id of the game in the archive.
+    //          const string& moves - The game's line from the archive.
+    //          vector<indexRecord>* run - Run buffer to append records to.
+    // Output:  Returns FALSE if the game contained an unreadable or illegal move.
+    // Caller:  chessIndex::indexWorker();
+    //
+    bool writeRun(vector<indexRecord>*);
+    // Purpose: Sorts a run buffer, writes it to a new temporary run file and empties the buffer.
+    // Input:   vector<indexRecord>* run - The run buffer to spill.
+    // Output:  Returns FALSE if the run file could not be written.
+    // Caller:  chessIndex::indexWorker();
+    //
+    bool mergeRuns(string);
+    // Purpose: Merges all sorted run files into the final index file, then removes the runs.  More runs than
+    //          can be merged at once are first merged in groups into longer runs.
+    // Input:   string indexPath - Path of the index file to write.
+    // Output:  Returns FALSE if a run could not be read or the index could not be written.
+    // Caller:  chessIndex::buildIndex();
+    //
+    bool mergeGroup(const vector<string>&, ofstream*, uint64_t*);
+    // Purpose: K-way merges sorted run files into one sorted stream of records, then removes the runs.
+    // Input:   const vector<string>& runs - Paths of the runs to merge.
+    //          ofstream* out - Receives the records, or NULL to only remove the runs after an earlier failure.
+    //          uint64_t* count - Incremented for every record written.
+    // Output:  Returns FALSE if a run could not be read, the output could not be written or out is NULL.
+    // Caller:  chessIndex::mergeRuns();
+    //
+
+    int threadCount;
+    // Number of worker tasks used by buildIndex().
+    size_t memoryBudget;
+    // Bytes of run buffer shared between all workers.
+    ifstream archive;
+    // Shared archive stream, read in batches under archiveLock.
+    mutex archiveLock, runLock;
+    // Guards the archive stream and game counters, and the list of run files respectively.
+    string runPrefix;
+    // Path prefix for temporary run files.
+    vector<string> runFiles;
+    // Paths of all sorted runs written so far.
+    uint32_t nextGameId, gamesRejected;
+    // Id of the next game line to be read, and the count of games that stopped early.
+    uint64_t recordCount;
+    // Records written to the final index.
+    bool runFailed;
+    // Set by a worker if a run file could not be written.
+};
+
+#endif /* CHESSINDEX_H */
+
@@ -0,0 +1,79 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessInput.cpp
+ *      Purpose: Non-blocking line reader over a file descriptor.
+ *      Input: Raw bytes read from the file descriptor, usually standard input.
+ *      Output: Complete lines of text, without the line terminator.
+ *      Exceptions: None. End of input and read errors are reported through isClosed().
+ *
+ */
+
+#include "chessInput.h"
+#include <cerrno>
+#include <poll.h>
+#include <unistd.h>
+
+chessInput::chessInput() {
+    inputFd = STDIN_FILENO;
+    endOfInput = false;
+}
+
+chessInput::chessInput(int fd) {
+    inputFd = fd;
+    endOfInput = false;
+}
+
+bool chessInput::pollLine(string* line, int timeoutMs){
+
+    // a line may already be buffered from an earlier read
+    if(takeLine(line)){
+        return true;
+    }
+    if(endOfInput){
+        // hand out a final line that was not terminated before end of file
+        if(!pending.empty()){
+            *line = pending;
+            pending.clear();
+            return true;
+        }
+        return false;
+    }
+
+    struct pollfd request;
+    request.fd = inputFd;
+    request.events = POLLIN;
+    request.revents = 0;
+    int ready = poll(&request, 1, timeoutMs);
+    if(ready <= 0){
+        return false;
+    }
+
+    char buffer[512];
+    ssize_t count = read(inputFd, buffer, sizeof(buffer));
+    if(count > 0){
+        pending.append(buffer, count);
+    }
+    else if(count == 0 || errno != EINTR){
+        endOfInput = true;
+    }
+    return takeLine(line) || (endOfInput && pollLine(line, 0));
+}
+
+bool chessInput::isClosed(){
+    return endOfInput && pending.empty();
+}
+
+bool chessInput::takeLine(string* line){
+    size_t end = pending.find('\n');
+    if(end == string::npos){
+        return false;
+    }
+    size_t length = end;
+    if(length > 0 && pending[length - 1] == '\r'){
+        length--;
+    }
+    line->assign(pending, 0, length);
+    pending.erase(0, end + 1);
+    return true;
+}
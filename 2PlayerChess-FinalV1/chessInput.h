@@ -0,0 +1,66 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessInput.h
+ *      Purpose: Non-blocking line reader over a file descriptor.  Lets the game loop wait for player input with a
+ *               timeout and do other work (or serve other games) while no complete line has been typed.
+ *      Input: Raw bytes read from the file descriptor, usually standard input.
+ *      Output: Complete lines of text, without the line terminator.
+ *      Exceptions: None. End of input and read errors are reported through isClosed().
+ *
+ */
+
+#ifndef CHESSINPUT_H
+#define CHESSINPUT_H
+#include <cstdlib>
+#include <string>
+#include "globals.h"
+
+using namespace std;
+
+class chessInput {
+public:
+    chessInput();
+    // Purpose: Default constructor. Reads from standard input.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::loopGameplay();
+    //
+    chessInput(int);
+    // Purpose: Overloaded constructor. Reads from a specific file descriptor, e.g. a socket or pipe.
+    // Input:   int fd - The file descriptor to read lines from.
+    // Output:  None.
+    // Caller:  None;
+    //
+    bool pollLine(string*, int);
+    // Purpose: Returns the next complete line if one is available, waiting at most timeoutMs for more input.
+    // Input:   string* line - Receives the line, without its '\n' or "\r\n" terminator.
+    //          int timeoutMs - Longest time to wait for input in milliseconds. 0 returns immediately.
+    // Output:  Returns TRUE if a line was stored in *line, FALSE if no complete line is available yet.
+    // Caller:  chessGame::loopGameplay();
+    //
+    bool isClosed();
+    // Purpose: Checks whether the input has reached end of file and every buffered line has been returned.
+    // Input:   None.
+    // Output:  Returns TRUE once no more lines will ever be returned.
+    // Caller:  chessGame::loopGameplay();
+    //
+
+private:
+    bool takeLine(string*);
+    // Purpose: Moves the first complete line out of the pending buffer.
+    // Input:   string* line - Receives the line.
+    // Output:  Returns TRUE if pending held a complete line.
+    // Caller:  chessInput::pollLine();
+    //
+
+    int inputFd;
+    // File descriptor that lines are read from.
+    string pending;
+    // Bytes read from the descriptor that do not yet form a complete line.
+    bool endOfInput;
+    // TRUE once the descriptor has reported end of file or an error.
+};
+
+#endif /* CHESSINPUT_H */
+
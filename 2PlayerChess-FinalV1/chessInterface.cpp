@@ -1,131 +1,312 @@
-/*      Author: Drew Tibbetts
- *      Creation Date: 6/22/2019
- *      Modification: 8/6/2019
- *      FileName: chessInterface.cpp
- *      Purpose: Handles all the processes related to outputting game play data to the screen for the user.
- *      Input: None.
- *      Output: None.
- *      Exceptions: None.
- * 
- */
-
-#include "chessInterface.h"
-
-chessInterface::chessInterface() {
-}
-
-// initialize point reference array of main chess board
-chessInterface::chessInterface(chessTile (*ptr)[8][8], gameState* s, color* player, color* check){
-    boardRef = ptr;
-    stateRef = s;
-    playerRef = player;
-    checkRef = check;
-}
-
-
-
-// returns chess piece character to draw to gameboard
-char chessInterface::getIcon(coordinates coords){
-    
-    char icon = (*boardRef)[coords.posX][coords.posY].getActivePiece().pieceIcon;
- 
-    return icon;
-}
-
-
-
-void chessInterface::drawChessBoard(){
-    
-    /* ROW 1 */
-    cout <<" __A__B__C__D__E__F__G__H__ " << endl;
-    cout <<" |   ///   ///   ///   ///| " << endl;
-    cout <<"8| "<< getIcon({0,0}) <<" /"<< getIcon({0,1}) <<"/ "<< getIcon({0,2}) <<" /"<< getIcon({0,3}) <<"/ "<< getIcon({0,4}) <<" /"<< getIcon({0,5}) <<"/ "<< getIcon({0,6}) <<" /"<< getIcon({0,7}) <<"/|8" << endl;
-    cout <<" |   ///   ///   ///   ///| " << endl;
-    /* ROW 2 */
-    cout <<" |///   ///   ///   ///   | " << endl;
-    cout <<"7|/"<< getIcon({1,0}) <<"/ "<< getIcon({1,1}) <<" /"<< getIcon({1,2}) <<"/ "<< getIcon({1,3}) <<" /"<< getIcon({1,4}) <<"/ "<< getIcon({1,5}) <<" /"<< getIcon({1,6}) <<"/ "<< getIcon({1,7}) <<" |7" << endl;
-    cout <<" |///   ///   ///   ///   | " << endl;
-    /* ROW 3 */
-    cout <<" |   ///   ///   ///   ///| " << endl;
-    cout <<"6| "<< getIcon({2,0}) <<" /"<< getIcon({2,1}) <<"/ "<< getIcon({2,2}) <<" /"<< getIcon({2,3}) <<"/ "<< getIcon({2,4}) <<" /"<< getIcon({2,5}) <<"/ "<< getIcon({2,6}) <<" /"<< getIcon({2,7}) <<"/|6" << endl;
-    cout <<" |   ///   ///   ///   ///| " << endl;
-    /* ROW 4 */
-    cout <<" |///   ///   ///   ///   | " << endl; 
-    cout <<"5|/"<< getIcon({3,0}) <<"/ "<< getIcon({3,1}) <<" /"<< getIcon({3,2}) <<"/ "<< getIcon({3,3}) <<" /"<< getIcon({3,4}) <<"/ "<< getIcon({3,5}) <<" /"<< getIcon({3,6}) <<"/ "<< getIcon({3,7}) <<" |5" << endl;
-    cout <<" |///   ///   ///   ///   | " << endl;
-    /* ROW 5 */
-    cout <<" |   ///   ///   ///   ///| " << endl;
-    cout <<"4| "<< getIcon({4,0}) <<" /"<< getIcon({4,1}) <<"/ "<< getIcon({4,2}) <<" /"<< getIcon({4,3}) <<"/ "<< getIcon({4,4}) <<" /"<< getIcon({4,5}) <<"/ "<< getIcon({4,6}) <<" /"<< getIcon({4,7}) <<"/|4" << endl;
-    cout <<" |   ///   ///   ///   ///| " << endl;
-    /* ROW 6 */
-    cout <<" |///   ///   ///   ///   | " << endl;
-    cout <<"3|/"<< getIcon({5,0}) <<"/ "<< getIcon({5,1}) <<" /"<< getIcon({5,2}) <<"/ "<< getIcon({5,3}) <<" /"<< getIcon({5,4}) <<"/ "<< getIcon({5,5}) <<" /"<< getIcon({5,6}) <<"/ "<< getIcon({5,7}) <<" |3" << endl;
-    cout <<" |///   ///   ///   ///   |     |||--------------|||" << endl;
-    /* ROW 7 */
-    cout <<" |   ///   ///   ///   ///|     ||| "<< playerTurn<<"'S TURN |||" << endl;
-    cout <<"2| "<< getIcon({6,0}) <<" /"<< getIcon({6,1}) <<"/ "<< getIcon({6,2}) <<" /"<< getIcon({6,3}) <<"/ "<< getIcon({6,4}) <<" /"<< getIcon({6,5}) <<"/ "<< getIcon({6,6}) <<" /"<< getIcon({6,7}) <<"/|2    |||--------------|||" << endl;
-    cout <<" |   ///   ///   ///   ///|     ||| "<< getLastAction() << endl;
-    /* ROW 8 */
-    cout <<" |///   ///   ///   ///   |     ||| " << gameStatus << endl;
-    cout <<"1|/"<< getIcon({7,0}) <<"/ "<< getIcon({7,1}) <<" /"<< getIcon({7,2}) <<"/ "<< getIcon({7,3}) <<" /"<< getIcon({7,4}) <<"/ "<< getIcon({7,5}) <<" /"<< getIcon({7,6}) <<"/ "<< getIcon({7,7}) <<" |1    ||| " << getErrorMessage() << endl;
-    cout <<" |///   ///   ///   ///   | " << endl;
-    cout <<"  -|--|--|--|--|--|--|--|-  " << endl;
-    cout <<"   A  B  C  D  E  F  G  H " << endl;
-    
-}
-
-void chessInterface::setPlayerTurn(){
-    playerTurn = (*playerRef == WHITE) ? "WHITE" : "BLACK";
-}
-
-
-void chessInterface::setGameStatus(){
-    switch(*stateRef){
-        case NORMALPLAY:
-            gameStatus = " ";
-            break;
-        case CHECK:
-            gameStatus = "CHECK: PLAYER "; 
-            gameStatus += (*checkRef == WHITE) ? "WHITE" : "BLACK";
-            gameStatus += " IS IN CHECK";
-            break;
-        case CHECKMATE:
-            gameStatus = "CHECKMATE: ";
-            gameStatus += (*checkRef == WHITE) ? "WHITE" : "BLACK";
-            gameStatus += " IS IN CHECKMATE. ";
-            gameStatus += (*checkRef == WHITE) ? "BLACK" : "WHITE";
-            gameStatus += " WINS THE GAME!!!";
-            break;
-        case STALEMATE:
-            gameStatus += "STALEMATE.  GAME ENDS IN A DRAW";
-            break;
-    }
-}
-
-void chessInterface::setLastAction(string s){
-    lastAction = s;
-}
-
-void chessInterface::setErrorMessasge(string s){
-    errorMessage = s;
-}
-
-string chessInterface::getErrorMessage(){
-    string msg;
-    if(*stateRef == ERROR){
-     msg = "INPUT ERROR: " + errorMessage;
-    }
-    else {
-     msg = " ";   
-    }
-    return msg;
-}
-
-string chessInterface::getLastAction(){
-    
-    return "LAST MOVE: " + lastAction;
-}
-
-void chessInterface::print(string s){
-    cout << s << endl;
+/*      Author: Drew Tibbetts
+ *      Creation Date: 6/22/2019
+ *      Modification: 10/19/2026
+ *      FileName: chessInterface.cpp
+ *      Purpose: Handles all the processes related to outputting game play data to the screen for the user.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ * 
+ */
+
+#include "chessInterface.h"
+#include <cerrno>
+#include <unistd.h>
+#include <sys/ioctl.h>
+
+namespace {
+
+    const int boardScreenRows = 27;
+    // number of screen rows used by the board and status panel
+    const int minimumAnsiRows = 36;
+    // terminals shorter than this scroll the board off screen during input, so frames are drawn in full instead
+    const int panelColumn = 37;
+    // screen column where the status panel text starts
+    const int turnRow = 20, actionRow = 22, statusRow = 23, errorRow = 24;
+    // screen rows of the status panel lines
+
+    // checks whether standard output is a terminal that can hold the board and the input prompts below it,
+    // and if so reports its size
+    bool isAnsiTerminal(struct winsize* size){
+        if(!isatty(STDOUT_FILENO)){
+            return false;
+        }
+        if(ioctl(STDOUT_FILENO, TIOCGWINSZ, size) != 0){
+            return false;
+        }
+        return size->ws_row >= minimumAnsiRows;
+    }
+
+    // appends the ANSI escape that moves the cursor to a 1 based row and column
+    void appendCursorMove(string* buffer, int row, int column){
+        *buffer += "\x1b[";
+        *buffer += to_string(row);
+        *buffer += ';';
+        *buffer += to_string(column);
+        *buffer += 'H';
+    }
+}
+
+chessInterface::chessInterface() {
+}
+
+// initialize point reference array of main chess board
+chessInterface::chessInterface(chessTile (*ptr)[8][8], gameState* s, color* player, color* check){
+    boardRef = ptr;
+    stateRef = s;
+    playerRef = player;
+    checkRef = check;
+    struct winsize size;
+    useAnsi = isAnsiTerminal(&size);
+    if(useAnsi){
+        screenRows = size.ws_row;
+        screenColumns = (size.ws_col > 0) ? size.ws_col : 80;
+    }
+    frameBuffer.reserve(4096);
+}
+
+
+
+// returns chess piece character to draw to gameboard
+char chessInterface::getIcon(coordinates coords){
+    
+    return (*boardRef)[coords.posX][coords.posY].getIcon();
+}
+
+
+
+void chessInterface::drawChessBoard(){
+    
+    frameBuffer.clear();
+    
+    if(!useAnsi){
+        // plain output, the whole frame scrolls past like normal console output
+        appendFullFrame();
+    }
+    else if(!frameDrawn){
+        // clear the screen and draw the board at the top of it
+        frameBuffer += "\x1b[H\x1b[2J";
+        appendFullFrame();
+        frameDrawn = true;
+        rowsBelowBoard = 0;
+    }
+    else{
+        // redraw only what changed, then clear the old prompts below the board
+        appendChangedSquares();
+        appendPanelLine(turnRow, playerTurn + "'S TURN |||", &drawnTurn);
+        appendPanelLine(actionRow, getLastAction(), &drawnAction);
+        appendPanelLine(statusRow, gameStatus, &drawnStatus);
+        appendPanelLine(errorRow, getErrorMessage(), &drawnError);
+        appendCursorMove(&frameBuffer, boardScreenRows + 1, 1);
+        frameBuffer += "\x1b[J";
+        rowsBelowBoard = 0;
+    }
+    
+    writeFrame();
+}
+
+void chessInterface::invalidateFrame(){
+    frameDrawn = false;
+}
+
+void chessInterface::appendFullFrame(){
+    
+    // even board rows start with a light square, odd rows with a dark one
+    const char* lightRow = " |   ///   ///   ///   ///| ";
+    const char* darkRow = " |///   ///   ///   ///   | ";
+    string& out = frameBuffer;
+    
+    out += " __A__B__C__D__E__F__G__H__ \n";
+    for(int i = 0; i < 8; i++){
+        bool isLight = (i % 2 == 0);
+        char rank = '8' - i;
+        
+        // upper line of the row, the status panel begins alongside row 6
+        if(i == 6){
+            out += " |   ///   ///   ///   ///|     ||| " + playerTurn + "'S TURN |||\n";
+        }
+        else if(i == 7){
+            out += " |///   ///   ///   ///   |     ||| " + gameStatus + "\n";
+        }
+        else{
+            out += isLight ? lightRow : darkRow;
+            out += '\n';
+        }
+        
+        // piece line of the row
+        out += rank;
+        out += '|';
+        for(int j = 0; j < 8; j++){
+            bool isLightSquare = ((i + j) % 2 == 0);
+            out += isLightSquare ? ' ' : '/';
+            out += getIcon({i,j});
+            out += isLightSquare ? ' ' : '/';
+            drawnIcons[i][j] = getIcon({i,j});
+        }
+        out += '|';
+        out += rank;
+        if(i == 6){
+            out += "    |||--------------|||";
+        }
+        else if(i == 7){
+            out += "    ||| " + getErrorMessage();
+        }
+        out += '\n';
+        
+        // lower line of the row
+        if(i == 5){
+            out += " |///   ///   ///   ///   |     |||--------------|||\n";
+        }
+        else if(i == 6){
+            out += " |   ///   ///   ///   ///|     ||| " + getLastAction() + "\n";
+        }
+        else{
+            out += isLight ? lightRow : darkRow;
+            out += '\n';
+        }
+    }
+    out += "  -|--|--|--|--|--|--|--|-  \n";
+    out += "   A  B  C  D  E  F  G  H \n";
+    
+    drawnTurn = playerTurn + "'S TURN |||";
+    drawnAction = getLastAction();
+    drawnStatus = gameStatus;
+    drawnError = getErrorMessage();
+}
+
+void chessInterface::appendChangedSquares(){
+    char icon;
+    for(int i = 0; i < 8; i++){
+        for(int j = 0; j < 8; j++){
+            icon = getIcon({i,j});
+            if(icon != drawnIcons[i][j]){
+                // each board row uses 3 screen rows and each square 3 columns
+                appendCursorMove(&frameBuffer, 3 + i * 3, 4 + j * 3);
+                frameBuffer += icon;
+                drawnIcons[i][j] = icon;
+            }
+        }
+    }
+}
+
+void chessInterface::appendPanelLine(int row, const string& text, string* drawn){
+    if(text != *drawn){
+        appendCursorMove(&frameBuffer, row, panelColumn);
+        frameBuffer += text;
+        frameBuffer += "\x1b[K";
+        *drawn = text;
+    }
+}
+
+void chessInterface::writeFrame(){
+    
+    // anything already queued in cout has to reach the screen before the frame
+    cout.flush();
+    
+    const char* data = frameBuffer.data();
+    size_t remaining = frameBuffer.size();
+    while(remaining > 0){
+        ssize_t written = write(STDOUT_FILENO, data, remaining);
+        if(written < 0 && errno == EINTR){
+            continue;
+        }
+        if(written <= 0){
+            break;
+        }
+        data += written;
+        remaining -= written;
+    }
+}
+
+void chessInterface::setPlayerTurn(){
+    playerTurn = (*playerRef == WHITE) ? "WHITE" : "BLACK";
+}
+
+
+void chessInterface::setGameStatus(){
+    switch(*stateRef){
+        case NORMALPLAY:
+            gameStatus = " ";
+            break;
+        case CHECK:
+            gameStatus = "CHECK: PLAYER "; 
+            gameStatus += (*checkRef == WHITE) ? "WHITE" : "BLACK";
+            gameStatus += " IS IN CHECK";
+            break;
+        case CHECKMATE:
+            gameStatus = "CHECKMATE: ";
+            gameStatus += (*checkRef == WHITE) ? "WHITE" : "BLACK";
+            gameStatus += " IS IN CHECKMATE. ";
+            gameStatus += (*checkRef == WHITE) ? "BLACK" : "WHITE";
+            gameStatus += " WINS THE GAME!!!";
+            break;
+        case STALEMATE:
+            gameStatus += "STALEMATE.  GAME ENDS IN A DRAW";
+            break;
+        case DRAW:
+            gameStatus = "DRAW: THE GAME ENDS IN A DRAW";
+            break;
+        case TIMEOUT:
+            gameStatus = "TIME: ";
+            gameStatus += (*playerRef == WHITE) ? "WHITE" : "BLACK";
+            gameStatus += " RAN OUT OF TIME. ";
+            gameStatus += (*playerRef == WHITE) ? "BLACK" : "WHITE";
+            gameStatus += " WINS THE GAME!!!";
+            break;
+    }
+}
+
+void chessInterface::setLastAction(string s){
+    lastAction = s;
+}
+
+void chessInterface::setErrorMessasge(string s){
+    errorMessage = s;
+}
+
+string chessInterface::getErrorMessage(){
+    string msg;
+    if(*stateRef == ERROR){
+     msg = "INPUT ERROR: " + errorMessage;
+    }
+    else {
+     msg = " ";   
+    }
+    return msg;
+}
+
+string chessInterface::getLastAction(){
+    
+    return "LAST MOVE: " + lastAction;
+}
+
+void chessInterface::print(string s){
+    cout << s << endl;
+    countRows(s);
+}
+
+void chessInterface::noteInput(const string& line){
+    countRows(line);
+}
+
+void chessInterface::countRows(const string& text){
+    if(!useAnsi || !frameDrawn){
+        return;
+    }
+    // every line takes at least one row, and long lines wrap onto more
+    size_t start = 0;
+    while(true){
+        size_t end = text.find('\n', start);
+        size_t length = ((end == string::npos) ? text.size() : end) - start;
+        rowsBelowBoard += (length == 0) ? 1 : (length + screenColumns - 1) / screenColumns;
+        if(end == string::npos){
+            break;
+        }
+        start = end + 1;
+    }
+    // once the cursor would pass the bottom of the screen the board has scrolled up, and changes drawn in
+    // place would land on the wrong rows
+    if(boardScreenRows + rowsBelowBoard >= screenRows){
+        invalidateFrame();
+    }
 }
\ No newline at end of file
@@ -1,105 +1,170 @@
-/*      Author: Drew Tibbetts
- *      Creation Date: 6/22/2019
- *      Modification: 8/6/2019
- *      FileName: chessInterface.h
- *      Purpose: Handles all the processes related to outputting game play data to the screen for the user.
- *               Communicates externally with the chessGame object.  Most methods are called externally by
- *               the chessGame class.
- *      Input: None.
- *      Output: None.
- *      Exceptions: None.
- * 
- */
-
-#ifndef CHESSINTERFACE_H
-#define CHESSINTERFACE_H
-#include <cstdlib>
-#include <iostream>
-#include <string>
-#include "globals.h"
-#include "chessTile.h"
-
-using namespace std;
-
-class chessInterface {
-public:
-    chessInterface();
-    // Purpose: Default constructor. Empty.
-    // Input:   None.
-    // Output:  None.
-    // Caller:  None(); 
-    //
-    chessInterface(chessTile (*ptr)[8][8], gameState*, color*, color*);
-    // Purpose: Overloaded constructor. Receives relevant game information as pointer references.
-    // Input:   chessTile (*ptr)[8][8] - Reference to the 8x8 chessBoard.
-    //          gameState* s - Reference to the game play state.
-    //          color* player - Reference to the current active player.
-    //          color* check - Reference to the current player if any who is in 'check'.
-    // Output:  None.
-    // Caller:  chessGame::startNewGame(); 
-    //
-    char getIcon(coordinates);
-    // Purpose: Returns the appropriate chess icon that represents a chess piece at a given position when called.
-    // Input:   coordinates coords - X,Y coordinates of the chess piece to get an icon of.
-    // Output:  Returns the ASCII character relating to the chess piece found at X,Y.
-    // Caller:  chessInterface::drawChessBoard();
-    //
-    void drawChessBoard();
-    // Purpose: Outputs the chess board in its current state and all relevant game data to the console screen for user.
-    // Input:   None.
-    // Output:  None.
-    // Caller:  chessGame::loopGameplay(); chessGame::endGame;
-    //
-    void setPlayerTurn();
-    // Purpose: Notifies the UI of the current active player, operating on the *playerRef variable.
-    // Input:   None.
-    // Output:  None.
-    // Caller:  chessGame::updateGameState();
-    //
-    void setGameStatus();
-    // Purpose: Notifies the UI of the current game play status, operating on the *stateRef variable.
-    // Input:   None.
-    // Output:  None.
-    // Caller:  chessGame::updateGameState();
-    //
-    void setErrorMessasge(string);
-    void setLastAction(string);
-    // Purpose: Notifies the UI of the current last action, populating the lastAction variable with data.
-    // Input:   string s - String data to store for output.
-    // Output:  None.
-    // Caller:  chessGame::updateGameState();
-    //
-    void print(string);
-    // Purpose: Outputs simple string data to the screen for the user.
-    // Input:   string s - String data to output.
-    // Output:  None.
-    // Caller:  chessGame;
-    //   
-    string getErrorMessage();
-    // Purpose: Returns the current error message to the screen when called.
-    // Input:   None.
-    // Output:  string msg - The string that contains the error data to return.
-    // Caller:  chessInterface::drawChessBoard();
-    //  
-    string getLastAction();
-    // Purpose: Returns the current last game play action to the screen when called.
-    // Input:   None.
-    // Output:  string msg - The string that contains the action data to return.
-    // Caller:  chessInterface::drawChessBoard();
-    //  
-    
-private:
-    string playerTurn, gameStatus, errorMessage, lastAction;
-    // Holds string data for the active player, the status of the game, any errors, and the last move played.
-    chessTile (*boardRef)[8][8] = NULL;
-    // Reference to the chessBoard from chessGame
-    gameState *stateRef = NULL;
-    // Reference to the current game play state from chessGame.
-    color* playerRef = NULL;
-    // Reference to current active player from chessGame.
-    color* checkRef = NULL;
-    // Reference to the current player if any that is in check.
-};
-
-#endif /* CHESSINTERFACE_H */
-
+/*      Author: Drew Tibbetts
+ *      Creation Date: 6/22/2019
+ *      Modification: 10/19/2026
+ *      FileName: chessInterface.h
+ *      Purpose: Handles all the processes related to outputting game play data to the screen for the user.
+ *               Communicates externally with the chessGame object.  Most methods are called externally by
+ *               the chessGame class.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ * 
+ */
+
+#ifndef CHESSINTERFACE_H
+#define CHESSINTERFACE_H
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include "globals.h"
+#include "chessTile.h"
+
+using namespace std;
+
+class chessInterface {
+public:
+    chessInterface();
+    // Purpose: Default constructor. Empty.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  None(); 
+    //
+    chessInterface(chessTile (*ptr)[8][8], gameState*, color*, color*);
+    // Purpose: Overloaded constructor. Receives relevant game information as pointer references.
+    // Input:   chessTile (*ptr)[8][8] - Reference to the 8x8 chessBoard.
+    //          gameState* s - Reference to the game play state.
+    //          color* player - Reference to the current active player.
+    //          color* check - Reference to the current player if any who is in 'check'.
+    // Output:  None.
+    // Caller:  chessGame::startNewGame(); 
+    //
+    char getIcon(coordinates);
+    // Purpose: Returns the appropriate chess icon that represents a chess piece at a given position when called.
+    // Input:   coordinates coords - X,Y coordinates of the chess piece to get an icon of.
+    // Output:  Returns the ASCII character relating to the chess piece found at X,Y.
+    // Caller:  chessInterface::drawChessBoard();
+    //
+    void drawChessBoard();
+    // Purpose: Outputs the chess board in its current state and all relevant game data to the console screen for user.
+    //          Each frame is built in frameBuffer and written with a single write call.  On terminals that support
+    //          it, only the squares and status lines that changed since the last frame are redrawn, using ANSI
+    //          cursor addressing.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::loopGameplay(); chessGame::endGame;
+    //
+    void invalidateFrame();
+    // Purpose: Forces the next drawChessBoard() call to redraw the whole screen, e.g. after other output has
+    //          overwritten the board.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessInterface::countRows();
+    //
+    void setPlayerTurn();
+    // Purpose: Notifies the UI of the current active player, operating on the *playerRef variable.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::updateGameState();
+    //
+    void setGameStatus();
+    // Purpose: Notifies the UI of the current game play status, operating on the *stateRef variable.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::updateGameState();
+    //
+    void setErrorMessasge(string);
+    void setLastAction(string);
+    // Purpose: Notifies the UI of the current last action, populating the lastAction variable with data.
+    // Input:   string s - String data to store for output.
+    // Output:  None.
+    // Caller:  chessGame::updateGameState();
+    //
+    void print(string);
+    // Purpose: Outputs simple string data to the screen for the user, below the board.  All output of a game
+    //          goes through here, so the rows it takes can be counted.
+    // Input:   string s - String data to output.
+    // Output:  None.
+    // Caller:  chessGame;
+    //   
+    void noteInput(const string&);
+    // Purpose: Counts the rows of a line the user typed, which the terminal echoed below the board.
+    // Input:   const string& line - The line read.
+    // Output:  None.
+    // Caller:  chessGame::loopGameplay();
+    //
+    string getErrorMessage();
+    // Purpose: Returns the current error message to the screen when called.
+    // Input:   None.
+    // Output:  string msg - The string that contains the error data to return.
+    // Caller:  chessInterface::drawChessBoard();
+    //  
+    string getLastAction();
+    // Purpose: Returns the current last game play action to the screen when called.
+    // Input:   None.
+    // Output:  string msg - The string that contains the action data to return.
+    // Caller:  chessInterface::drawChessBoard();
+    //  
+    
+private:
+    void appendFullFrame();
+    // Purpose: Appends the complete board and status panel to frameBuffer.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessInterface::drawChessBoard();
+    //
+    void appendChangedSquares();
+    // Purpose: Appends cursor moves and icons for every square whose icon differs from the last drawn frame.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessInterface::drawChessBoard();
+    //
+    void appendPanelLine(int, const string&, string*);
+    // Purpose: Appends a rewrite of one status panel line if its text differs from the last drawn frame.
+    // Input:   int row - Screen row of the panel line, 1 based.
+    //          const string& text - Text that should now be shown on the line.
+    //          string* drawn - The text last drawn on the line, updated when the line is rewritten.
+    // Output:  None.
+    // Caller:  chessInterface::drawChessBoard();
+    //
+    void countRows(const string&);
+    // Purpose: Adds the screen rows a piece of text takes to rowsBelowBoard, and invalidates the frame once
+    //          the output below the board would scroll the screen.
+    // Input:   const string& text - The text written or echoed, without its final newline.
+    // Output:  None.
+    // Caller:  chessInterface::print(); chessInterface::noteInput();
+    //
+    void writeFrame();
+    // Purpose: Writes frameBuffer to standard output with a single write call, after flushing cout.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessInterface::drawChessBoard();
+    //
+    
+    string playerTurn, gameStatus, errorMessage, lastAction;
+    // Holds string data for the active player, the status of the game, any errors, and the last move played.
+    chessTile (*boardRef)[8][8] = NULL;
+    // Reference to the chessBoard from chessGame
+    gameState *stateRef = NULL;
+    // Reference to the current game play state from chessGame.
+    color* playerRef = NULL;
+    // Reference to current active player from chessGame.
+    color* checkRef = NULL;
+    // Reference to the current player if any that is in check.
+    string frameBuffer;
+    // Holds the output of the frame being drawn until it is written to the screen.
+    bool useAnsi = false;
+    // TRUE if output is a terminal tall enough to hold the board, so changed squares can be redrawn in place.
+    bool frameDrawn = false;
+    // TRUE once a full frame is on screen that later frames can be drawn on top of.
+    int screenRows = 0, screenColumns = 80;
+    // Size of the terminal when useAnsi is set.
+    int rowsBelowBoard = 0;
+    // Screen rows written below the board since the last frame.
+    char drawnIcons[8][8];
+    // Icons of each square as of the last drawn frame.
+    string drawnTurn, drawnAction, drawnStatus, drawnError;
+    // Text of each status panel line as of the last drawn frame.
+};
+
+#endif /* CHESSINTERFACE_H */
+
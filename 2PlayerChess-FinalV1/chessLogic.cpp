@@ -1,709 +1,914 @@
-/*      Author: Drew Tibbetts
- *      Creation Date: 6/22/2019
- *      Modification: 8/6/2019
- *      FileName: chessLogic.cpp
- *      Purpose: Handles all the game play logic needed to conduct a game of 2-player chess.
- *      Input: None.
- *      Output: None.
- *      Exceptions: None.
- * 
- */
-
-#include "chessLogic.h"
-
-
-chessLogic::chessLogic() {
-}
-// Overloaded constructor. Initializes memory references found in chessGame.h
-chessLogic::chessLogic(chessTile (*ptr)[8][8], color* c, color* ck){
-    boardRef = ptr;
-    colorRef = c;
-    checkRef = ck;
-}
-
-// returns a time from the chess board
-chessTile chessLogic::getTile(coordinates c){
-    
-    return (*boardRef)[c.posX][c.posY];
-}
-
-// returns FALSE if player enters starting coordinates that denote an empty space on the chessboard
-bool chessLogic::isValidPiece(coordinates coords){
-    
-    if((*boardRef)[coords.posX][coords.posY].getActivePiece().pieceIcon == ' '){
-        return false;
-    }
-    else{
-        return true;
-    }  
-}
-
-// returns FALSE if player enters starting coordinates that denote an opposing player's piece
-bool chessLogic::isPlayerPiece(coordinates coords, color playerColor){
-    if((*boardRef)[coords.posX][coords.posY].getActivePiece().pieceColor == playerColor ){
-        return true;
-    }
-    else{
-        return false;
-    }
-}
-
-// returns TRUE if the player tries to move one of their pieces on top of another of their pieces
-bool chessLogic::isPlayerDestination(coordinates coords, color playerColor){
-    if((*boardRef)[coords.posX][coords.posY].getActivePiece().pieceColor == playerColor){
-        return true;
-    }
-    else{
-        return false;
-    }
-    
-}
-
-
-// checks if movement is valid based on the piece type and position on the board
-bool chessLogic::isValidPieceMove(coordinates from, coordinates to){
-    availableMoves.clear();
-    chessPieceType pieceToCheck = (*boardRef)[from.posX][from.posY].getActivePiece().pieceType;
-    bool isValid = false;
-    switch(pieceToCheck){
-        case PAWN:
-            queryValidPawnMoves(from, *colorRef, &availableMoves);
-            break;
-        case ROOK:
-            queryValidRookMoves(from, *colorRef, &availableMoves);
-            break;
-        case KNIGHT:
-            queryValidKnightMoves(from, *colorRef, &availableMoves);
-            break;
-        case BISHOP:
-            queryValidBishopMoves(from, *colorRef, &availableMoves);
-            break;
-        case QUEEN:
-            queryValidQueenMoves(from, *colorRef);
-            break;
-        case KING:
-            queryValidKingMoves(from, *colorRef, &availableMoves);
-            break;
-        default:
-            break;
-    }
-    for(int i = 0; i < availableMoves.size(); i++){  
-        // cout << "DEBUG -- Valid destination: " << availableMoves.at(i).posX << ", " << availableMoves.at(i).posY << endl; // debug line
-        if(availableMoves.at(i).posX == to.posX && availableMoves.at(i).posY == to.posY){
-            return true;
-        }
-    }
-    return isValid;
-}
-
-// simulates move, then checks if moving player is in check before reverting the game move
-bool chessLogic::isMoveCheckForKing(coordinates from, coordinates to, color c){  
-    bool isCheck;
-    // backup the two pieces to check
-    chessTile backupFrom = (*boardRef)[from.posX][from.posY];
-    chessTile backupTo = (*boardRef)[to.posX][to.posY];
-    // simulate move
-    (*boardRef)[to.posX][to.posY] = (*boardRef)[from.posX][from.posY];
-    (*boardRef)[from.posX][from.posY].emptyTile();
-    // check if player's king is in check in simulated board
-    isCheck = isPlayerInCheck(c);
-    // restore board position to original state
-    (*boardRef)[from.posX][from.posY] = backupFrom;
-    (*boardRef)[to.posX][to.posY] = backupTo;
-    return isCheck;  
-}
-
-void chessLogic::setKingPosition(coordinates pos, color c){   
-    if(c == WHITE){
-        wKingPos.posX = pos.posX;
-        wKingPos.posY = pos.posY;
-    }
-    else {
-        bKingPos.posX = pos.posX;
-        bKingPos.posY = pos.posY;
-    }   
-}
-
-// PIECE QUERY METHODS
-// BASED ON PIECE TYPE AND COORDINATES RECEIVED
-// FILLS PASSED THROUGH VECTOR WITH ALL VIABLE DESTINATION COORDINATES
-// LEGAL FOR THAT CHESS PIECE TYPE
-
-void chessLogic::queryValidPawnMoves(coordinates from, color c, vector<coordinates>* vc){
-    
-    coordinates offset;
-    int startX; 
-    // determine query direction based on player color
-    int dir;
-    switch(c){
-        case WHITE:
-            dir = -1;
-            startX = 6;
-            break;
-        case BLACK:
-            dir = 1;
-            startX = 1;
-            break;
-    }
-    
-    // move forward 1 space
-    offset = {from.posX + dir, from.posY};
-    if(offset.posX < 8 && offset.posX >= 0){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() == NONE){            
-            vc->push_back(offset);    
-        }
-    }
-    // move forward 2 space if pawn has not moved once yet and there are no pieces blocking the move
-    offset = {from.posX + (dir*2), from.posY};
-    if(offset.posX < 8 && offset.posX >= 0){
-        if((*boardRef)[from.posX + dir][from.posY].getControllingPlayer() == NONE && (*boardRef)[offset.posX][offset.posY].getControllingPlayer() == NONE && from.posX == startX){
-            vc->push_back(offset);    
-        }
-    }
-    // check diagonal forward left for enemy piece to capture
-    offset = {from.posX + dir, from.posY - 1};
-    if(offset.posX < 8 && offset.posX >= 0 && offset.posY >= 0){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                vc->push_back(offset);    
-            }
-        }
-    }
-    // check diagonal forward  right for enemy piece to capture
-    offset = {from.posX + dir, from.posY + 1};
-    if(offset.posX < 8 && offset.posX >= 0 && offset.posY < 8){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                vc->push_back(offset);    
-            }
-        }
-    }   
-}
-
-void chessLogic::queryValidRookMoves(coordinates from, color c, vector<coordinates>* vc){
-    
-    // set directional block flags that flag TRUE once a pieces movement is blocked
-    bool isBlockedU = false, isBlockedD = false, isBlockedL = false, isBlockedR = false;
-    coordinates tempCoords;
-
-    // logic for determining valid moves for the rook piece at this location
-    for(int i = 1; i < 8; i++){  
-        // check tiles downward
-        if(from.posX + i < 8 && !isBlockedD) {
-            
-            tempCoords.posX = from.posX + i;
-            tempCoords.posY = from.posY;
-           
-            if((*boardRef)[from.posX + i][from.posY].getControllingPlayer() != NONE){
-                if((*boardRef)[from.posX + i][from.posY].getControllingPlayer() != c){
-                    vc->push_back(tempCoords);
-                }
-                isBlockedD = true;
-            }
-            else{
-                vc->push_back(tempCoords);
-            }  
-        }
-        // check tiles upward
-        if(from.posX - i >= 0 && !isBlockedU) {
-          
-            tempCoords.posX = from.posX - i;
-            tempCoords.posY = from.posY;
- 
-            if((*boardRef)[from.posX - i][from.posY].getControllingPlayer() != NONE){
-                if((*boardRef)[from.posX - i][from.posY].getControllingPlayer() != c){
-                    vc->push_back(tempCoords);
-                }
-                isBlockedU = true;
-            }
-            else{
-                vc->push_back(tempCoords);
-            }
-             
-        }    
-        // check tiles rightward
-        if(from.posY + i < 8 && !isBlockedR){
-            
-            tempCoords.posX = from.posX;
-            tempCoords.posY = from.posY + i;
-            
-           
-            if((*boardRef)[from.posX][from.posY + i].getControllingPlayer() != NONE){
-                if((*boardRef)[from.posX][from.posY + i].getControllingPlayer() != c){
-                    vc->push_back(tempCoords);
-                }
-                isBlockedR = true;
-            }
-            else{
-                vc->push_back(tempCoords);
-            }
-           
-        } 
-        // check tiles leftward
-        if(from.posY - i >= 0 && !isBlockedL){
-           
-            tempCoords.posX = from.posX;
-            tempCoords.posY = from.posY - i;
-            
-            
-            if((*boardRef)[from.posX][from.posY - i].getControllingPlayer() != NONE){
-                if((*boardRef)[from.posX][from.posY - i].getControllingPlayer() != c){
-                  vc->push_back(tempCoords);  
-                }
-                isBlockedL = true;
-            }
-            else{
-                vc->push_back(tempCoords);
-            }   
-        }      
-    }   
-}
-
-void chessLogic::queryValidKnightMoves(coordinates from, color c, vector<coordinates>* vc){
-    
-    coordinates offset;
-    
-    // check bottom right 1
-    offset = {from.posX + 2, from.posY + 1};
-    if(offset.posX < 8 && offset.posY < 8){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                vc->push_back(offset);  
-            }  
-        }
-        else{
-            vc->push_back(offset);
-        }
-    }
-    // check bottom right 2
-    offset = {from.posX + 1, from.posY + 2};
-    if(offset.posX < 8 && offset.posY < 8){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                vc->push_back(offset);  
-            }  
-        }
-        else{
-            vc->push_back(offset);
-        }
-    }
-    // check top right 1
-    offset = {from.posX - 1, from.posY + 2};
-    if(offset.posX >= 0 && offset.posY < 8){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                vc->push_back(offset);  
-            }  
-        }
-        else{
-            vc->push_back(offset);
-        }
-    }
-    // check top right 2
-    offset = {from.posX - 2, from.posY + 1};
-    if(offset.posX >= 0 && offset.posY < 8){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                vc->push_back(offset);  
-            }  
-        }
-        else{
-            vc->push_back(offset);
-        }
-    }
-    // check bottom left 1
-    offset = {from.posX + 1, from.posY - 2};
-    if(offset.posX < 8 && offset.posY >= 0){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                vc->push_back(offset);  
-            }  
-        }
-        else{
-            vc->push_back(offset);
-        }
-    }
-    // check bottom left 2
-    offset = {from.posX + 2, from.posY - 1};
-    if(offset.posX < 8 && offset.posY >= 0){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                vc->push_back(offset);  
-            }  
-        }
-        else{
-            vc->push_back(offset);
-        }
-    }
-    // check top left 1
-    offset = {from.posX - 2, from.posY - 1};
-    if(offset.posX >= 0 && offset.posY >= 0){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                vc->push_back(offset);  
-            }  
-        }
-        else{
-            vc->push_back(offset);
-        }
-    }
-    // check top left 2
-    offset = {from.posX - 1, from.posY - 2};
-    if(offset.posX >= 0 && offset.posY >= 0){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                vc->push_back(offset);  
-            }  
-        }
-        else{
-            vc->push_back(offset);
-        }
-    }
-    
-}
-
-void chessLogic::queryValidBishopMoves(coordinates from, color c, vector<coordinates>* vc){
-    
-    // set directional block flags that flag TRUE once a pieces movement is blocked
-    bool isBlockedUL = false, isBlockedUR = false, isBlockedDL = false, isBlockedDR = false;
-    coordinates offset;
-    
-    // loop through all valid bishop moves in each diagonal direction, expanding outward from starting position
-    
-    for(int i = 1; i < 8; i++){
-        
-        // check up and to the left
-       // cout << "Starting position: " << from.posX << "," << from.posY << endl;
-        offset = {from.posX - i, from.posY - i};
-      //  cout << "Check for valid UL move at coordinates: " << offset.posX << "," << offset.posY << endl;
-        if(offset.posX >= 0 && offset.posY >= 0 && !isBlockedUL) {
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-                if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                    vc->push_back(offset);
-                }
-                isBlockedUL = true;
-            }
-            else{
-                vc->push_back(offset);
-            }  
-        }
-        
-        // check up and to the right
-        offset = {from.posX - i, from.posY + i};
-     //   cout << "Check for valid UR move at coordinates: " << offset.posX << "," << offset.posY << endl;
-        if(offset.posX >= 0 && offset.posY < 8 && !isBlockedUR) {
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-                if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                    vc->push_back(offset);
-                }
-                isBlockedUR = true;
-            }
-            else{
-                vc->push_back(offset);
-            }  
-        }
-        // check down and to the left
-        offset = {from.posX + i, from.posY - i};
-    //    cout << "Check for valid DL move at coordinates: " << offset.posX << "," << offset.posY << endl;
-        if(offset.posX < 8 && offset.posY >= 0 && !isBlockedDL) {
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-                if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                    vc->push_back(offset);
-                }
-                isBlockedDL = true;
-            }
-            else{
-                vc->push_back(offset);
-            }  
-        }
-        // check down and to the right
-        offset = {from.posX + i, from.posY + i};
-      //  cout << "Check for valid DR move at coordinates: " << offset.posX << "," << offset.posY << endl;
-        if(offset.posX < 8 && offset.posY < 8 && !isBlockedDR) {
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-                if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                    vc->push_back(offset);
-                }
-                isBlockedDR = true;
-            }
-            else{
-                vc->push_back(offset);
-            }  
-        }      
-    }  
-}
-
-void chessLogic::queryValidQueenMoves(coordinates from, color c){
-
-        queryValidRookMoves(from, *colorRef, &availableMoves);
-        queryValidBishopMoves(from, *colorRef, &availableMoves);
-     
-}
-
-void chessLogic::queryValidKingMoves(coordinates from, color c, vector<coordinates>* vc){
-    
-    coordinates offset;
-    
-   
-    // check diagonal
-    offset = {from.posX + 1, from.posY + 1};
-    if(offset.posX < 8 && offset.posY < 8){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                vc->push_back(offset);  
-            }  
-        }
-        else{
-            vc->push_back(offset);
-        }
-    }
-    offset = {from.posX - 1, from.posY + 1};
-    if(offset.posX >= 0 && offset.posY < 8){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                vc->push_back(offset);  
-            }  
-        }
-        else{
-            vc->push_back(offset);
-        }
-    }
-    offset = {from.posX + 1, from.posY - 1};
-    if(offset.posX < 8 && offset.posY >= 0){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                vc->push_back(offset);  
-            }  
-        }
-        else{
-            vc->push_back(offset);
-        }
-    }
-    offset = {from.posX - 1, from.posY - 1};
-    if(offset.posX >= 0 && offset.posY >= 0){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                vc->push_back(offset);  
-            }  
-        }
-        else{
-            vc->push_back(offset);
-        }
-    }
-    // check rank diretions
-    offset = {from.posX + 1, from.posY};
-    if(offset.posX < 8 && offset.posY >= 0){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                vc->push_back(offset);  
-            }  
-        }
-        else{
-            vc->push_back(offset);
-        }
-    }
-    offset = {from.posX - 1, from.posY};
-    if(offset.posX >= 0 && offset.posY >= 0){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                vc->push_back(offset);  
-            }  
-        }
-        else{
-            vc->push_back(offset);
-        }
-    }
-    offset = {from.posX, from.posY + 1};
-    if(offset.posX >= 0 && offset.posY < 8){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                vc->push_back(offset);  
-            }  
-        }
-        else{
-            vc->push_back(offset);
-        }
-    }
-    offset = {from.posX, from.posY - 1};
-    if(offset.posX >= 0 && offset.posY >= 0){
-        if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
-            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
-                vc->push_back(offset);  
-            }  
-        }
-        else{
-            vc->push_back(offset);
-        }
-    }                                   
-}
-
-
-// adds all valid moves for all pieces of a color to colorMoves vector;
-void chessLogic::queryAllMovesByColor(color c){
-    colorMoves.clear();
-    chessTile tile;
-    // query every tile on the board and get the piece
-    for(int i = 0; i < 8; i++){
-        for(int j = 0; j < 8; j++){
-            tile = getTile({i,j});
-            if(tile.getControllingPlayer() == c){
-                switch(tile.getActivePiece().pieceType){
-                    case PAWN:
-                        queryValidPawnMoves({i,j}, c, &colorMoves);
-                         break;
-                    case ROOK:
-                         queryValidRookMoves({i,j}, c, &colorMoves);
-                         break;
-                    case KNIGHT:
-                        queryValidKnightMoves({i,j}, c, &colorMoves);
-                        break;
-                    case BISHOP:
-                        queryValidBishopMoves({i,j}, c, &colorMoves);
-                        break;
-                    case QUEEN:
-                        queryValidRookMoves({i,j}, c, &colorMoves);
-                        queryValidBishopMoves({i,j}, c, &colorMoves);
-                        break;
-                    case KING:
-                        queryValidKingMoves({i,j}, c, &colorMoves);
-                        break;
-                    default:
-                        break;   
-                }
-            }
-        }
-    } 
-}
-
-
-
-// returns tile that holds King piece of chosen color
-chessTile chessLogic::getKing(color c){  
-   chessTile tile;
-   for(int i = 0; i < 8; i++){
-        for(int j = 0; j < 8; j++){
-            tile = getTile({i,j});
-            if(tile.getControllingPlayer() == c){
-                switch(tile.getActivePiece().pieceType){
-                    case KING:
-                        setKingPosition({i,j}, c);
-                        return tile;
-                        break;
-                    default:
-                        break;   
-                }
-            }
-        }
-    }     
-}
-
-
-
-coordinates chessLogic::getKingPosition(color c){
-    if(c == WHITE){
-        return wKingPos;
-    }
-    else{
-        return bKingPos;
-    }
-}
-
-bool chessLogic::isPlayerInCheck(color c){
-    
-    chessTile kingTile = getKing(c);
-    coordinates kingPos = getKingPosition(c);
-    
-    if(c == WHITE){
-        queryAllMovesByColor(BLACK);
-    }
-    else{
-        queryAllMovesByColor(WHITE);
-    }
-    
-    for(int i = 0; i < colorMoves.size(); i++){  
-        if(colorMoves.at(i).posX == kingPos.posX && colorMoves.at(i).posY == kingPos.posY){
-            return true;
-        }
-    }
-    
-    return false;
-}
-
-// called if a king is in check. gets all the possible moves from a player color,
-// and sees if there is any way to protect against check
-bool chessLogic::isPlayerOutOfMoves(color c){
-    
-    int movesInCheck = 0;
-    int totalAvailableMoves = 0;
-    vector<coordinates> newMoves;
-    chessTile tile;
-    
-    
-        // query every tile on the board and get the piece
-        for(int i = 0; i < 8; i++){
-            for(int j = 0; j < 8; j++){
-                // reset pool of moves each pass through
-                
-                tile = getTile({i,j});
-                if(tile.getControllingPlayer() == c){
-                    
-                    newMoves.clear(); 
-                  //  cout << "CHECK FOR TILE PIECE TYPE: " << tile.getActivePiece().pieceIcon << " at " << i << "," << j << endl;
-                    switch(tile.getActivePiece().pieceType){
-                        case PAWN:
-                            queryValidPawnMoves({i,j}, c, &newMoves);
-                            totalAvailableMoves += newMoves.size();
-                             break;
-                        case ROOK:
-                             queryValidRookMoves({i,j}, c, &newMoves);
-                             totalAvailableMoves += newMoves.size();
-                             break;
-                        case KNIGHT:
-                            queryValidKnightMoves({i,j}, c, &newMoves);                            
-                            totalAvailableMoves += newMoves.size();
-                            break;
-                        case BISHOP:
-                            queryValidBishopMoves({i,j}, c, &newMoves);
-                            totalAvailableMoves += newMoves.size();
-                            break;
-                        case QUEEN:
-                            queryValidRookMoves({i,j}, c, &newMoves);
-                            totalAvailableMoves += newMoves.size();
-                            queryValidBishopMoves({i,j}, c, &newMoves);
-                            totalAvailableMoves += newMoves.size();
-                            break;
-                        case KING:
-                            queryValidKingMoves({i,j}, c, &newMoves);
-                            totalAvailableMoves += newMoves.size();
-                            break;
-                        default:                            
-                            break;   
-                    }
-                  //  cout << "Total Available Moves: " << totalAvailableMoves << endl;
-                    if (newMoves.size() >= 1 ){
-                        // add number of available moves to the total then check if moves are in check
-                        
-                        for(int x = 0; x < newMoves.size(); x++){
-                       //     cout << "check for check at pos " << i << "," << j << " to " << newMoves.at(x).posX << "," << newMoves.at(x).posY  << endl;
-                            if(isMoveCheckForKing({i,j}, newMoves.at(x), c)){
-
-                                movesInCheck++;
-                            }
-                        }
-                    }
-                }
-            }
-        }     
-    
-    
-   // cout << "Total Available Moves: " << totalAvailableMoves << endl;
-   // cout << "Total moves in check: " << movesInCheck << endl;
-    
-    if(movesInCheck == totalAvailableMoves){
-        return true;
-    }
-    else{
-        return false;
-    } 
-}
-
+/*      Author: Drew Tibbetts
+ *      Creation Date: 6/22/2019
+ *      Modification: 10/19/2026
+ *      FileName: chessLogic.cpp
+ *      Purpose: Handles all the game play logic needed to conduct a game of 2-player chess.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ * 
+ */
+
+#include "chessLogic.h"
+#include <algorithm>
+#include "chessStats.h"
+#include "chessAttacks.h"
+
+
+chessLogic::chessLogic() {
+}
+// Overloaded constructor. Initializes memory references found in chessGame.h
+chessLogic::chessLogic(chessTile (*ptr)[8][8], color* c, color* ck, boardRights* r){
+    boardRef = ptr;
+    colorRef = c;
+    checkRef = ck;
+    rightsRef = r;
+}
+
+// returns a time from the chess board
+chessTile chessLogic::getTile(coordinates c){
+    
+    chessStats::increment(BOARD_COPIES);
+    return (*boardRef)[c.posX][c.posY];
+}
+
+// returns FALSE if player enters starting coordinates that denote an empty space on the chessboard
+bool chessLogic::isValidPiece(coordinates coords){
+    
+    if((*boardRef)[coords.posX][coords.posY].getActivePiece().pieceIcon == ' '){
+        return false;
+    }
+    else{
+        return true;
+    }  
+}
+
+// returns FALSE if player enters starting coordinates that denote an opposing player's piece
+bool chessLogic::isPlayerPiece(coordinates coords, color playerColor){
+    if((*boardRef)[coords.posX][coords.posY].getActivePiece().pieceColor == playerColor ){
+        return true;
+    }
+    else{
+        return false;
+    }
+}
+
+// returns TRUE if the player tries to move one of their pieces on top of another of their pieces
+bool chessLogic::isPlayerDestination(coordinates coords, color playerColor){
+    if((*boardRef)[coords.posX][coords.posY].getActivePiece().pieceColor == playerColor){
+        return true;
+    }
+    else{
+        return false;
+    }
+    
+}
+
+
+// checks if movement is valid based on the piece type and position on the board. Knights and sliding pieces are
+// checked by the geometry of the move alone; pawns and kings have special moves, so only their few moves are listed.
+bool chessLogic::isValidPieceMove(coordinates from, coordinates to){
+    chessPieceType pieceToCheck = (*boardRef)[from.posX][from.posY].getActivePiece().pieceType;
+    int dx = to.posX - from.posX;
+    int dy = to.posY - from.posY;
+    chessStats::countMoveGeneration(pieceToCheck);
+    // no piece moves onto a piece of its own side, which also rules out staying on its square
+    if((*boardRef)[to.posX][to.posY].getControllingPlayer() == *colorRef){
+        return false;
+    }
+    availableMoves.clear();
+    switch(pieceToCheck){
+        case PAWN:
+            queryValidPawnMoves(from, *colorRef, &availableMoves);
+            break;
+        case ROOK:
+            return (dx == 0 || dy == 0) && isLineClear(from, to);
+        case KNIGHT:
+            return (chessAttacks::knight.mask[from.posX * 8 + from.posY] >> (to.posX * 8 + to.posY)) & 1;
+        case BISHOP:
+            return (dx == dy || dx == -dy) && isLineClear(from, to);
+        case QUEEN:
+            return (dx == 0 || dy == 0 || dx == dy || dx == -dy) && isLineClear(from, to);
+        case KING:
+            if((chessAttacks::king.mask[from.posX * 8 + from.posY] >> (to.posX * 8 + to.posY)) & 1){
+                return true;
+            }
+            // otherwise only castling is left
+            queryValidKingMoves(from, *colorRef, &availableMoves);
+            break;
+        default:
+            break;
+    }
+    for(int i = 0; i < availableMoves.size(); i++){  
+        if(availableMoves.at(i).posX == to.posX && availableMoves.at(i).posY == to.posY){
+            return true;
+        }
+    }
+    return false;
+}
+
+// checks that every square strictly between two squares on one line is empty
+bool chessLogic::isLineClear(coordinates from, coordinates to){
+    int stepX = (to.posX > from.posX) ? 1 : (to.posX < from.posX) ? -1 : 0;
+    int stepY = (to.posY > from.posY) ? 1 : (to.posY < from.posY) ? -1 : 0;
+    int x = from.posX + stepX;
+    int y = from.posY + stepY;
+    while(x != to.posX || y != to.posY){
+        if((*boardRef)[x][y].getControllingPlayer() != NONE){
+            return false;
+        }
+        x += stepX;
+        y += stepY;
+    }
+    return true;
+}
+
+// simulates move, then checks if moving player is in check before reverting the game move
+bool chessLogic::isMoveCheckForKing(coordinates from, coordinates to, color c){  
+    if(c == WHITE){
+        return isMoveIntoCheck<WHITE>(from, to);
+    }
+    return isMoveIntoCheck<BLACK>(from, to);
+}
+
+template<color Us>
+bool chessLogic::isMoveIntoCheck(coordinates from, coordinates to){
+    bool isCheck;
+    moveUndo undo;
+    chessStats::increment(CHECK_SIMULATIONS);
+    // simulate move
+    makeMove({from, to, NOPIECE}, &undo);
+    // check if player's king is in check in simulated board
+    isCheck = isKingInCheck<Us>();
+    // restore board position to original state
+    unmakeMove(undo);
+    return isCheck;  
+}
+
+namespace {
+    // castling rights lost when a piece moves from or to a square: the king's and rooks' home squares
+    int castlingRightsAt(coordinates sq){
+        if(sq.posX == 7){
+            return (sq.posY == 4) ? WHITE_KINGSIDE | WHITE_QUEENSIDE : (sq.posY == 7) ? WHITE_KINGSIDE : (sq.posY == 0) ? WHITE_QUEENSIDE : 0;
+        }
+        if(sq.posX == 0){
+            return (sq.posY == 4) ? BLACK_KINGSIDE | BLACK_QUEENSIDE : (sq.posY == 7) ? BLACK_KINGSIDE : (sq.posY == 0) ? BLACK_QUEENSIDE : 0;
+        }
+        return 0;
+    }
+}
+
+void chessLogic::makeMove(chessMove move, moveUndo* undo){
+    chessTile* startTile = &(*boardRef)[move.from.posX][move.from.posY];
+    chessTile* endTile = &(*boardRef)[move.to.posX][move.to.posY];
+    pieceData piece = startTile->getActivePiece();
+    chessStats::increment(BOARD_COPIES, 2);
+    
+    undo->move = move;
+    undo->movedPiece = *startTile;
+    undo->capturedPiece = *endTile;
+    undo->capturedAt = move.to;
+    undo->rights = *rightsRef;
+    
+    // a pawn moving diagonally onto an empty square captures en passant, the captured pawn is beside it
+    if(piece.pieceType == PAWN && move.from.posY != move.to.posY && endTile->getControllingPlayer() == NONE){
+        undo->capturedAt = {move.from.posX, move.to.posY};
+        undo->capturedPiece = (*boardRef)[move.from.posX][move.to.posY];
+        (*boardRef)[move.from.posX][move.to.posY].emptyTile();
+    }
+    
+    // move the starting tile to the destination, and nullify the origin after
+    *endTile = *startTile;
+    startTile->emptyTile();
+    if(piece.pieceType == KING){
+        setKingPosition(move.to, piece.pieceColor);
+    }
+    
+    if(piece.pieceType == PAWN && (move.to.posX == 0 || move.to.posX == 7)){
+        *endTile = chessTile(chessPiece((move.promotion == NOPIECE) ? QUEEN : move.promotion, piece.pieceColor));
+    }
+    // castling also moves the rook to the square the king crossed
+    else if(piece.pieceType == KING && (move.to.posY - move.from.posY == 2 || move.from.posY - move.to.posY == 2)){
+        int rookFrom = (move.to.posY > move.from.posY) ? 7 : 0;
+        int rookTo = (move.to.posY > move.from.posY) ? 5 : 3;
+        (*boardRef)[move.from.posX][rookTo] = (*boardRef)[move.from.posX][rookFrom];
+        (*boardRef)[move.from.posX][rookFrom].emptyTile();
+    }
+    
+    // update rights: a double step allows an en passant reply, king and rook moves or captures end castling
+    rightsRef->enPassant = {-1, -1};
+    if(piece.pieceType == PAWN && (move.to.posX - move.from.posX == 2 || move.from.posX - move.to.posX == 2)){
+        rightsRef->enPassant = {(move.from.posX + move.to.posX) / 2, move.from.posY};
+    }
+    rightsRef->castling &= ~(castlingRightsAt(move.from) | castlingRightsAt(move.to));
+    // captures and pawn moves cannot be undone, so no earlier position can repeat after them
+    rightsRef->halfmoveClock = (piece.pieceType == PAWN || undo->capturedPiece.getControllingPlayer() != NONE) ? 0 : rightsRef->halfmoveClock + 1;
+}
+
+void chessLogic::unmakeMove(const moveUndo& undo){
+    chessMove move = undo.move;
+    
+    // put the rook of a castling move back in its corner
+    if((*boardRef)[move.to.posX][move.to.posY].getActivePiece().pieceType == KING && (move.to.posY - move.from.posY == 2 || move.from.posY - move.to.posY == 2)){
+        int rookFrom = (move.to.posY > move.from.posY) ? 7 : 0;
+        int rookTo = (move.to.posY > move.from.posY) ? 5 : 3;
+        (*boardRef)[move.from.posX][rookFrom] = (*boardRef)[move.from.posX][rookTo];
+        (*boardRef)[move.from.posX][rookTo].emptyTile();
+    }
+    (*boardRef)[move.to.posX][move.to.posY].emptyTile();
+    (*boardRef)[undo.capturedAt.posX][undo.capturedAt.posY] = undo.capturedPiece;
+    (*boardRef)[move.from.posX][move.from.posY] = undo.movedPiece;
+    *rightsRef = undo.rights;
+    pieceData piece = (*boardRef)[move.from.posX][move.from.posY].getActivePiece();
+    if(piece.pieceType == KING){
+        setKingPosition(move.from, piece.pieceColor);
+    }
+}
+
+bool chessLogic::isSquareAttacked(coordinates sq, color attacker){
+    if(attacker == WHITE){
+        return isSquareAttackedBy<WHITE>(sq);
+    }
+    return isSquareAttackedBy<BLACK>(sq);
+}
+
+template<color Them>
+bool chessLogic::isSquareAttackedBy(coordinates sq){
+    static const int lineSteps[8][2] = {{-1,-1}, {-1,0}, {-1,1}, {0,-1}, {0,1}, {1,-1}, {1,0}, {1,1}};
+    pieceData piece;
+    coordinates from;
+    int x, y;
+    int square = sq.posX * 8 + sq.posY;
+    
+    // an attacking pawn stands where a pawn of the other color on the square would capture
+    const attackTable& pawns = chessAttacks::pawn[(Them == WHITE) ? BLACK : WHITE];
+    for(int i = 0; i < pawns.count[square]; i++){
+        from = pawns.targets[square][i];
+        piece = (*boardRef)[from.posX][from.posY].getActivePiece();
+        if(piece.pieceType == PAWN && piece.pieceColor == Them){
+            return true;
+        }
+    }
+    for(int i = 0; i < chessAttacks::knight.count[square]; i++){
+        from = chessAttacks::knight.targets[square][i];
+        piece = (*boardRef)[from.posX][from.posY].getActivePiece();
+        if(piece.pieceType == KNIGHT && piece.pieceColor == Them){
+            return true;
+        }
+    }
+    for(int i = 0; i < chessAttacks::king.count[square]; i++){
+        from = chessAttacks::king.targets[square][i];
+        piece = (*boardRef)[from.posX][from.posY].getActivePiece();
+        if(piece.pieceType == KING && piece.pieceColor == Them){
+            return true;
+        }
+    }
+    // sliding pieces, along each line until the first occupied square
+    for(int i = 0; i < 8; i++){
+        bool isDiagonal = (lineSteps[i][0] != 0 && lineSteps[i][1] != 0);
+        x = sq.posX + lineSteps[i][0];
+        y = sq.posY + lineSteps[i][1];
+        while(x >= 0 && x < 8 && y >= 0 && y < 8){
+            if((*boardRef)[x][y].getControllingPlayer() != NONE){
+                piece = (*boardRef)[x][y].getActivePiece();
+                if(piece.pieceColor == Them && (piece.pieceType == QUEEN || piece.pieceType == (isDiagonal ? BISHOP : ROOK))){
+                    return true;
+                }
+                break;
+            }
+            x += lineSteps[i][0];
+            y += lineSteps[i][1];
+        }
+    }
+    return false;
+}
+
+namespace {
+    const int exchangeValues[7] = {100, 500, 320, 330, 900, 20000, 0};
+    // value of each chessPieceType in an exchange. The king is worth more than anything it could win.
+}
+
+int chessLogic::staticExchange(chessMove move){
+    int gain[32];
+    int depth = 0;
+    coordinates at;
+    pieceData mover = (*boardRef)[move.from.posX][move.from.posY].getActivePiece();
+    chessPieceType victim = (*boardRef)[move.to.posX][move.to.posY].getActivePiece().pieceType;
+    uint64_t removed = uint64_t(1) << (move.from.posX * 8 + move.from.posY);
+    
+    // a pawn moving diagonally onto an empty square takes the pawn beside it en passant
+    if(victim == NOPIECE && mover.pieceType == PAWN && move.from.posY != move.to.posY){
+        victim = PAWN;
+        removed |= uint64_t(1) << (move.from.posX * 8 + move.to.posY);
+    }
+    gain[0] = exchangeValues[victim];
+    int onSquare = exchangeValues[mover.pieceType];
+    if(move.promotion != NOPIECE){
+        gain[0] += exchangeValues[move.promotion] - exchangeValues[PAWN];
+        onSquare = exchangeValues[move.promotion];
+    }
+    
+    // gain[d] is the balance for the side making the d-th capture, assuming it is recaptured if at all possible
+    color side = (mover.pieceColor == WHITE) ? BLACK : WHITE;
+    do{
+        depth++;
+        gain[depth] = onSquare - gain[depth - 1];
+        // neither stopping nor capturing can make up for it; the exchange has already been decided
+        if(max(-gain[depth - 1], gain[depth]) < 0){
+            break;
+        }
+        chessPieceType attacker = findLeastAttacker(move.to, side, removed, &at);
+        if(attacker == NOPIECE){
+            break;
+        }
+        onSquare = exchangeValues[attacker];
+        removed |= uint64_t(1) << (at.posX * 8 + at.posY);
+        side = (side == WHITE) ? BLACK : WHITE;
+    } while(depth < 31);
+    // unwind: each side stops as soon as capturing again would leave it worse off. The last, assumed capture
+    // is never made.
+    while(--depth > 0){
+        gain[depth - 1] = -max(-gain[depth - 1], gain[depth]);
+    }
+    return gain[0];
+}
+
+chessPieceType chessLogic::findLeastAttacker(coordinates sq, color side, uint64_t removed, coordinates* at){
+    static const int lineSteps[8][2] = {{-1,-1}, {-1,0}, {-1,1}, {0,-1}, {0,1}, {1,-1}, {1,0}, {1,1}};
+    int square = sq.posX * 8 + sq.posY;
+    
+    // the first piece of a type and color on a table entry that is still on the board
+    auto findLeaper = [&](const attackTable& table, chessPieceType type){
+        for(int i = 0; i < table.count[square]; i++){
+            coordinates from = table.targets[square][i];
+            pieceData piece = (*boardRef)[from.posX][from.posY].getActivePiece();
+            if(piece.pieceType == type && piece.pieceColor == side && !((removed >> (from.posX * 8 + from.posY)) & 1)){
+                *at = from;
+                return true;
+            }
+        }
+        return false;
+    };
+    // an attacking pawn stands where a pawn of the other color on the square would capture
+    if(findLeaper(chessAttacks::pawn[(side == WHITE) ? BLACK : WHITE], PAWN)){
+        return PAWN;
+    }
+    if(findLeaper(chessAttacks::knight, KNIGHT)){
+        return KNIGHT;
+    }
+    // the first piece along each line counts, looking through removed pieces to the ones behind them
+    chessPieceType best = NOPIECE;
+    for(int i = 0; i < 8; i++){
+        bool isDiagonal = (lineSteps[i][0] != 0 && lineSteps[i][1] != 0);
+        int x = sq.posX + lineSteps[i][0];
+        int y = sq.posY + lineSteps[i][1];
+        while(x >= 0 && x < 8 && y >= 0 && y < 8){
+            if((*boardRef)[x][y].getControllingPlayer() != NONE && !((removed >> (x * 8 + y)) & 1)){
+                pieceData piece = (*boardRef)[x][y].getActivePiece();
+                if(piece.pieceColor == side && (piece.pieceType == QUEEN || piece.pieceType == (isDiagonal ? BISHOP : ROOK))
+                        && (best == NOPIECE || exchangeValues[piece.pieceType] < exchangeValues[best])){
+                    best = piece.pieceType;
+                    *at = {x, y};
+                }
+                break;
+            }
+            x += lineSteps[i][0];
+            y += lineSteps[i][1];
+        }
+    }
+    if(best != NOPIECE){
+        return best;
+    }
+    if(findLeaper(chessAttacks::king, KING)){
+        return KING;
+    }
+    return NOPIECE;
+}
+
+void chessLogic::setKingPosition(coordinates pos, color c){   
+    if(c == WHITE){
+        wKingPos.posX = pos.posX;
+        wKingPos.posY = pos.posY;
+    }
+    else {
+        bKingPos.posX = pos.posX;
+        bKingPos.posY = pos.posY;
+    }   
+}
+
+// PIECE QUERY METHODS
+// BASED ON PIECE TYPE AND COORDINATES RECEIVED
+// FILLS PASSED THROUGH VECTOR WITH ALL VIABLE DESTINATION COORDINATES
+// LEGAL FOR THAT CHESS PIECE TYPE
+
+void chessLogic::queryValidPawnMoves(coordinates from, color c, vector<coordinates>* vc){
+    if(c == WHITE){
+        queryPawnMoves<WHITE>(from, vc);
+    }
+    else{
+        queryPawnMoves<BLACK>(from, vc);
+    }
+}
+
+template<color Us>
+void chessLogic::queryPawnMoves(coordinates from, vector<coordinates>* vc){
+    
+    // WHITE pawns move towards row 0 and BLACK pawns towards row 7
+    const int dir = (Us == WHITE) ? -1 : 1;
+    const int startX = (Us == WHITE) ? 6 : 1;
+    coordinates offset;
+    
+    // move forward 1 space, and 2 spaces if the pawn has not moved yet and neither space is blocked
+    offset = {from.posX + dir, from.posY};
+    if(offset.posX < 8 && offset.posX >= 0 && (*boardRef)[offset.posX][offset.posY].getControllingPlayer() == NONE){
+        vc->push_back(offset);
+        if(from.posX == startX && (*boardRef)[offset.posX + dir][offset.posY].getControllingPlayer() == NONE){
+            vc->push_back({offset.posX + dir, offset.posY});
+        }
+    }
+    // capture diagonally forward onto enemy pieces
+    int square = from.posX * 8 + from.posY;
+    for(int i = 0; i < chessAttacks::pawn[Us].count[square]; i++){
+        offset = chessAttacks::pawn[Us].targets[square][i];
+        color target = (*boardRef)[offset.posX][offset.posY].getControllingPlayer();
+        if(target != NONE && target != Us){
+            vc->push_back(offset);
+        }
+    }
+    // capture en passant onto the square an enemy pawn just skipped. It lies on the 6th rank seen from this side.
+    if(rightsRef != NULL && rightsRef->enPassant.posX == from.posX + dir && rightsRef->enPassant.posX == startX + dir * 4){
+        if(rightsRef->enPassant.posY == from.posY - 1 || rightsRef->enPassant.posY == from.posY + 1){
+            vc->push_back(rightsRef->enPassant);
+        }
+    }
+}
+
+void chessLogic::queryValidRookMoves(coordinates from, color c, vector<coordinates>* vc){
+    
+    // set directional block flags that flag TRUE once a pieces movement is blocked
+    bool isBlockedU = false, isBlockedD = false, isBlockedL = false, isBlockedR = false;
+    coordinates tempCoords;
+
+    // logic for determining valid moves for the rook piece at this location
+    for(int i = 1; i < 8; i++){  
+        // check tiles downward
+        if(from.posX + i < 8 && !isBlockedD) {
+            
+            tempCoords.posX = from.posX + i;
+            tempCoords.posY = from.posY;
+           
+            if((*boardRef)[from.posX + i][from.posY].getControllingPlayer() != NONE){
+                if((*boardRef)[from.posX + i][from.posY].getControllingPlayer() != c){
+                    vc->push_back(tempCoords);
+                }
+                isBlockedD = true;
+            }
+            else{
+                vc->push_back(tempCoords);
+            }  
+        }
+        // check tiles upward
+        if(from.posX - i >= 0 && !isBlockedU) {
+          
+            tempCoords.posX = from.posX - i;
+            tempCoords.posY = from.posY;
+ 
+            if((*boardRef)[from.posX - i][from.posY].getControllingPlayer() != NONE){
+                if((*boardRef)[from.posX - i][from.posY].getControllingPlayer() != c){
+                    vc->push_back(tempCoords);
+                }
+                isBlockedU = true;
+            }
+            else{
+                vc->push_back(tempCoords);
+            }
+             
+        }    
+        // check tiles rightward
+        if(from.posY + i < 8 && !isBlockedR){
+            
+            tempCoords.posX = from.posX;
+            tempCoords.posY = from.posY + i;
+            
+           
+            if((*boardRef)[from.posX][from.posY + i].getControllingPlayer() != NONE){
+                if((*boardRef)[from.posX][from.posY + i].getControllingPlayer() != c){
+                    vc->push_back(tempCoords);
+                }
+                isBlockedR = true;
+            }
+            else{
+                vc->push_back(tempCoords);
+            }
+           
+        } 
+        // check tiles leftward
+        if(from.posY - i >= 0 && !isBlockedL){
+           
+            tempCoords.posX = from.posX;
+            tempCoords.posY = from.posY - i;
+            
+            
+            if((*boardRef)[from.posX][from.posY - i].getControllingPlayer() != NONE){
+                if((*boardRef)[from.posX][from.posY - i].getControllingPlayer() != c){
+                  vc->push_back(tempCoords);  
+                }
+                isBlockedL = true;
+            }
+            else{
+                vc->push_back(tempCoords);
+            }   
+        }      
+    }   
+}
+
+void chessLogic::queryValidKnightMoves(coordinates from, color c, vector<coordinates>* vc){
+    
+    // every square the knight attacks, except those held by its own pieces
+    int square = from.posX * 8 + from.posY;
+    for(int i = 0; i < chessAttacks::knight.count[square]; i++){
+        coordinates to = chessAttacks::knight.targets[square][i];
+        if((*boardRef)[to.posX][to.posY].getControllingPlayer() != c){
+            vc->push_back(to);
+        }
+    }
+}
+
+void chessLogic::queryValidBishopMoves(coordinates from, color c, vector<coordinates>* vc){
+    
+    // set directional block flags that flag TRUE once a pieces movement is blocked
+    bool isBlockedUL = false, isBlockedUR = false, isBlockedDL = false, isBlockedDR = false;
+    coordinates offset;
+    
+    // loop through all valid bishop moves in each diagonal direction, expanding outward from starting position
+    
+    for(int i = 1; i < 8; i++){
+        
+        // check up and to the left
+       // cout << "Starting position: " << from.posX << "," << from.posY << endl;
+        offset = {from.posX - i, from.posY - i};
+      //  cout << "Check for valid UL move at coordinates: " << offset.posX << "," << offset.posY << endl;
+        if(offset.posX >= 0 && offset.posY >= 0 && !isBlockedUL) {
+            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
+                if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
+                    vc->push_back(offset);
+                }
+                isBlockedUL = true;
+            }
+            else{
+                vc->push_back(offset);
+            }  
+        }
+        
+        // check up and to the right
+        offset = {from.posX - i, from.posY + i};
+     //   cout << "Check for valid UR move at coordinates: " << offset.posX << "," << offset.posY << endl;
+        if(offset.posX >= 0 && offset.posY < 8 && !isBlockedUR) {
+            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
+                if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
+                    vc->push_back(offset);
+                }
+                isBlockedUR = true;
+            }
+            else{
+                vc->push_back(offset);
+            }  
+        }
+        // check down and to the left
+        offset = {from.posX + i, from.posY - i};
+    //    cout << "Check for valid DL move at coordinates: " << offset.posX << "," << offset.posY << endl;
+        if(offset.posX < 8 && offset.posY >= 0 && !isBlockedDL) {
+            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
+                if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
+                    vc->push_back(offset);
+                }
+                isBlockedDL = true;
+            }
+            else{
+                vc->push_back(offset);
+            }  
+        }
+        // check down and to the right
+        offset = {from.posX + i, from.posY + i};
+      //  cout << "Check for valid DR move at coordinates: " << offset.posX << "," << offset.posY << endl;
+        if(offset.posX < 8 && offset.posY < 8 && !isBlockedDR) {
+            if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != NONE){
+                if((*boardRef)[offset.posX][offset.posY].getControllingPlayer() != c){
+                    vc->push_back(offset);
+                }
+                isBlockedDR = true;
+            }
+            else{
+                vc->push_back(offset);
+            }  
+        }      
+    }  
+}
+
+void chessLogic::queryValidQueenMoves(coordinates from, color c){
+
+        availableMoves.clear();
+        queryValidRookMoves(from, *colorRef, &availableMoves);
+        queryValidBishopMoves(from, *colorRef, &availableMoves);
+     
+}
+
+void chessLogic::queryValidKingMoves(coordinates from, color c, vector<coordinates>* vc){
+    
+    // every square the king attacks, except those held by its own pieces
+    int square = from.posX * 8 + from.posY;
+    for(int i = 0; i < chessAttacks::king.count[square]; i++){
+        coordinates to = chessAttacks::king.targets[square][i];
+        if((*boardRef)[to.posX][to.posY].getControllingPlayer() != c){
+            vc->push_back(to);
+        }
+    }
+    
+    // castling, from the king's home square towards a rook that has not moved either
+    int homeRow = (c == WHITE) ? 7 : 0;
+    int kingside = (c == WHITE) ? WHITE_KINGSIDE : BLACK_KINGSIDE;
+    int queenside = (c == WHITE) ? WHITE_QUEENSIDE : BLACK_QUEENSIDE;
+    color opponent = (c == WHITE) ? BLACK : WHITE;
+    if(rightsRef == NULL || (rightsRef->castling & (kingside | queenside)) == 0 || from.posX != homeRow || from.posY != 4){
+        return;
+    }
+    chessTile* row = (*boardRef)[homeRow];
+    pieceData rook;
+    if(rightsRef->castling & kingside){
+        rook = row[7].getActivePiece();
+        if(rook.pieceType == ROOK && rook.pieceColor == c && row[5].getControllingPlayer() == NONE && row[6].getControllingPlayer() == NONE
+                && !isSquareAttacked(from, opponent) && !isSquareAttacked({homeRow, 5}, opponent)){
+            vc->push_back({homeRow, 6});
+        }
+    }
+    if(rightsRef->castling & queenside){
+        rook = row[0].getActivePiece();
+        if(rook.pieceType == ROOK && rook.pieceColor == c && row[1].getControllingPlayer() == NONE && row[2].getControllingPlayer() == NONE
+                && row[3].getControllingPlayer() == NONE && !isSquareAttacked(from, opponent) && !isSquareAttacked({homeRow, 3}, opponent)){
+            vc->push_back({homeRow, 2});
+        }
+    }
+}
+
+
+// adds all valid moves for all pieces of a color to colorMoves vector;
+void chessLogic::queryAllMovesByColor(color c){
+    colorMoves.clear();
+    if(c == WHITE){
+        queryMovesByColor<WHITE>(&colorMoves);
+    }
+    else{
+        queryMovesByColor<BLACK>(&colorMoves);
+    }
+}
+
+template<color Us>
+void chessLogic::queryMovesByColor(vector<coordinates>* vc){
+    chessTile tile;
+    // query every tile on the board and get the piece
+    for(int i = 0; i < 8; i++){
+        for(int j = 0; j < 8; j++){
+            tile = getTile({i,j});
+            if(tile.getControllingPlayer() == Us){
+                chessStats::countMoveGeneration(tile.getActivePiece().pieceType);
+                switch(tile.getActivePiece().pieceType){
+                    case PAWN:
+                        queryPawnMoves<Us>({i,j}, vc);
+                        break;
+                    case ROOK:
+                        queryValidRookMoves({i,j}, Us, vc);
+                        break;
+                    case KNIGHT:
+                        queryValidKnightMoves({i,j}, Us, vc);
+                        break;
+                    case BISHOP:
+                        queryValidBishopMoves({i,j}, Us, vc);
+                        break;
+                    case QUEEN:
+                        queryValidRookMoves({i,j}, Us, vc);
+                        queryValidBishopMoves({i,j}, Us, vc);
+                        break;
+                    case KING:
+                        queryValidKingMoves({i,j}, Us, vc);
+                        break;
+                    default:
+                        break;   
+                }
+            }
+        }
+    } 
+}
+
+
+
+// returns tile that holds King piece of chosen color
+chessTile chessLogic::getKing(color c){  
+   chessTile tile;
+   for(int i = 0; i < 8; i++){
+        for(int j = 0; j < 8; j++){
+            tile = getTile({i,j});
+            if(tile.getControllingPlayer() == c){
+                switch(tile.getActivePiece().pieceType){
+                    case KING:
+                        setKingPosition({i,j}, c);
+                        return tile;
+                        break;
+                    default:
+                        break;   
+                }
+            }
+        }
+    }
+    return chessTile();
+}
+
+
+
+coordinates chessLogic::getKingPosition(color c){
+    if(c == WHITE){
+        return getKingSquare<WHITE>();
+    }
+    return getKingSquare<BLACK>();
+}
+
+template<color Us>
+coordinates chessLogic::getKingSquare(){
+    coordinates square = (Us == WHITE) ? wKingPos : bKingPos;
+    // makeMove() and unmakeMove() keep the square up to date, so the board only has to be searched after it
+    // was set up some other way, such as from a FEN position or a copy of another board
+    if(square.posX >= 0){
+        pieceData piece = (*boardRef)[square.posX][square.posY].getActivePiece();
+        if(piece.pieceType == KING && piece.pieceColor == Us){
+            return square;
+        }
+    }
+    getKing(Us);
+    return (Us == WHITE) ? wKingPos : bKingPos;
+}
+
+bool chessLogic::isPlayerInCheck(color c){
+    if(c == WHITE){
+        return isKingInCheck<WHITE>();
+    }
+    return isKingInCheck<BLACK>();
+}
+
+// looks outward from the king's square for an enemy piece attacking it
+template<color Us>
+bool chessLogic::isKingInCheck(){
+    
+    chessStats::increment(CHECK_TESTS);
+    coordinates square = getKingSquare<Us>();
+    if(square.posX < 0){
+        return false;
+    }
+    return isSquareAttackedBy<(Us == WHITE) ? BLACK : WHITE>(square);
+}
+
+// adds every move of a color that does not leave its own king in check, one per promotion piece
+void chessLogic::generateLegalMoves(color c, vector<chessMove>* moves, moveKind kinds){
+    if(c == WHITE){
+        generateMoves<WHITE>(moves, kinds);
+    }
+    else{
+        generateMoves<BLACK>(moves, kinds);
+    }
+}
+
+template<color Us>
+void chessLogic::generateMoves(vector<chessMove>* moves, moveKind kinds){
+    static const chessPieceType promotions[4] = {QUEEN, ROOK, BISHOP, KNIGHT};
+    const int lastRow = (Us == WHITE) ? 0 : 7;
+    chessTile tile;
+    
+    for(int i = 0; i < 8; i++){
+        for(int j = 0; j < 8; j++){
+            tile = getTile({i,j});
+            if(tile.getControllingPlayer() != Us){
+                continue;
+            }
+            pieceMoves.clear();
+            chessPieceType pieceType = tile.getActivePiece().pieceType;
+            chessStats::countMoveGeneration(pieceType);
+            switch(pieceType){
+                case PAWN:
+                    queryPawnMoves<Us>({i,j}, &pieceMoves);
+                    break;
+                case ROOK:
+                    queryValidRookMoves({i,j}, Us, &pieceMoves);
+                    break;
+                case KNIGHT:
+                    queryValidKnightMoves({i,j}, Us, &pieceMoves);
+                    break;
+                case BISHOP:
+                    queryValidBishopMoves({i,j}, Us, &pieceMoves);
+                    break;
+                case QUEEN:
+                    queryValidRookMoves({i,j}, Us, &pieceMoves);
+                    queryValidBishopMoves({i,j}, Us, &pieceMoves);
+                    break;
+                case KING:
+                    queryValidKingMoves({i,j}, Us, &pieceMoves);
+                    break;
+                default:
+                    break;
+            }
+            for(int x = 0; x < pieceMoves.size(); x++){
+                coordinates to = pieceMoves.at(x);
+                // a capture lands on an enemy piece, or is a pawn moving diagonally onto the en passant square
+                bool isCapture = (*boardRef)[to.posX][to.posY].getControllingPlayer() != NONE || (pieceType == PAWN && to.posY != j);
+                if(!(kinds & (isCapture ? CAPTURE_MOVES : QUIET_MOVES)) || isMoveIntoCheck<Us>({i,j}, to)){
+                    continue;
+                }
+                if(pieceType == PAWN && to.posX == lastRow){
+                    for(int p = 0; p < 4; p++){
+                        moves->push_back({{i,j}, to, promotions[p]});
+                    }
+                }
+                else{
+                    moves->push_back({{i,j}, to, NOPIECE});
+                }
+            }
+        }
+    }
+}
+
+uint64_t chessLogic::perft(int depth){
+    if(depth <= 0){
+        return 1;
+    }
+    if(perftMoves.size() < depth + 1){
+        perftMoves.resize(depth + 1);
+    }
+    
+    // the move list of each ply is kept in perftMoves[depth], so the lists are reused between nodes
+    color side = *colorRef;
+    vector<chessMove>& moves = perftMoves[depth];
+    moves.clear();
+    generateLegalMoves(side, &moves);
+    if(depth == 1){
+        chessStats::increment(NODES_SEARCHED, moves.size());
+        return moves.size();
+    }
+    
+    uint64_t nodes = 0;
+    moveUndo undo;
+    *colorRef = (side == WHITE) ? BLACK : WHITE;
+    for(int i = 0; i < moves.size(); i++){
+        makeMove(moves[i], &undo);
+        nodes += perft(depth - 1);
+        unmakeMove(undo);
+    }
+    *colorRef = side;
+    chessStats::increment(NODES_SEARCHED);
+    return nodes;
+}
+
+// called if a king is in check. gets the possible moves from a player color one piece at a time,
+// and sees if there is any way to protect against check. Stops at the first move that does.
+bool chessLogic::isPlayerOutOfMoves(color c){
+    
+    vector<coordinates>& newMoves = pieceMoves; // reused between calls so no move list is allocated
+    chessTile tile;
+    
+    // query every tile on the board and get the piece
+    for(int i = 0; i < 8; i++){
+        for(int j = 0; j < 8; j++){
+            tile = getTile({i,j});
+            if(tile.getControllingPlayer() != c){
+                continue;
+            }
+            newMoves.clear(); 
+            chessStats::countMoveGeneration(tile.getActivePiece().pieceType);
+            switch(tile.getActivePiece().pieceType){
+                case PAWN:
+                    queryValidPawnMoves({i,j}, c, &newMoves);
+                    break;
+                case ROOK:
+                    queryValidRookMoves({i,j}, c, &newMoves);
+                    break;
+                case KNIGHT:
+                    queryValidKnightMoves({i,j}, c, &newMoves);
+                    break;
+                case BISHOP:
+                    queryValidBishopMoves({i,j}, c, &newMoves);
+                    break;
+                case QUEEN:
+                    queryValidRookMoves({i,j}, c, &newMoves);
+                    queryValidBishopMoves({i,j}, c, &newMoves);
+                    break;
+                case KING:
+                    queryValidKingMoves({i,j}, c, &newMoves);
+                    break;
+                default:                            
+                    break;   
+            }
+            for(int x = 0; x < newMoves.size(); x++){
+                if(!isMoveCheckForKing({i,j}, newMoves.at(x), c)){
+                    return false;
+                }
+            }
+        }
+    }     
+    return true;
+}
@@ -1,201 +1,331 @@
-/*      Author: Drew Tibbetts
- *      Creation Date: 6/22/2019
- *      Modification: 8/6/2019
- *      FileName: chessLogic.h
- *      Purpose: Handles all the game play logic needed to conduct a game of 2-player chess.
- *               Communicates externally with the chessGame object.  Most methods are called externally by
- *               the chessGame class.
- *      Input: None.
- *      Output: None.
- *      Exceptions: None.
- * 
- */
-
-#ifndef CHESSLOGIC_H
-#define CHESSLOGIC_H
-#include <cstdlib>
-#include <string>
-#include <vector>
-#include <exception>
-#include "globals.h"
-#include "chessTile.h"
-#include "chessPiece.h"
-#include "chessInterface.h"
-
-#include <iostream> // debug tests
-
-using namespace std;
-
-class chessLogic {
-  
-public:
-    
-    chessLogic();
-    // Purpose: Default constructor. Empty.
-    // Input:   None.
-    // Output:  None.
-    // Caller:  None; 
-    //
-    chessLogic(chessTile (*ptr)[8][8], color*, color*);
-    // Purpose: Default constructor. Empty.
-    // Input:   chessTile (*ptr)[8][8] - Reference to the 8x8 chessBoard for used for game play.
-    //          color* c - Reference to the current active player, WHITE OR BLACK.
-    //          color* ck - Reference to the current player if any that is in 'check'.
-    // Output:  None.
-    // Caller:  chessGame::startNewGame(); 
-    // 
-    chessTile getTile(coordinates);
-    // Purpose: Returns the specific chess tile and any piece data at that tile of X,Y position on the game board.
-    // Input:   coordinates c - X,Y position of the chess board to get the piece from.
-    // Output:  Returns the specific chessTile object at X,Y position.
-    // Caller:  Various chessLogic methods. 
-    // 
-    bool isValidPiece(coordinates);
-    // Purpose: Checks whether the given starting X,Y coordinates on the chess board contain a chess piece.
-    // Input:   coordinates coords - X,Y position of the chess board to check.
-    // Output:  Returns TRUE if space is occupied by a valid chess piece, otherwise returns FALSE.
-    // Caller:  chessGame::isValidMove();
-    // 
-    bool isPlayerPiece(coordinates, color);
-    // Purpose: Checks whether the starting given X,Y coordinates on the chess board contain a chess piece
-    //          controlled by the current active player.
-    // Input:   coordinates coords - X,Y position of the chess board to check.
-    //          color playerColor - Color of the active player.
-    // Output:  Returns TRUE if space is occupied by a chess piece the active player controls.
-    // Caller:  chessGame::isValidMove();
-    // 
-    bool isPlayerDestination(coordinates, color);
-    // Purpose: Checks whether the given destination X,Y coordinates on the chess board contain a chess piece
-    //          controlled by the current active player.
-    // Input:   coordinates coords - X,Y position of the chess board to check.
-    //          color playerColor - Color of the active player.
-    // Output:  Returns TRUE if space is occupied by a chess piece the active player controls.
-    // Caller:  chessGame::isValidMove();
-    // 
-    bool isValidPieceMove(coordinates, coordinates);
-    // Purpose: Checks whether chess piece at starting coordinates can legally perform the move at the 
-    //          destination coordinates.  Queries all possible legal moves of the relevant chess piece
-    //          type and checks if any of them match the destination coordinates.
-    // Input:   coordinates from - Starting X,Y position of the chess board to check.
-    //          coordinates to - Destination X,Y position of the requested move.
-    // Output:  Returns TRUE if the destination coordinates is a valid legal move for the chess piece.
-    // Caller:  chessGame::isValidMove();
-    // 
-    bool isMoveCheckForKing(coordinates, coordinates, color);
-    // Purpose: Checks whether the requested move would result in putting the active player into check.
-    //          Simulates the move, analyzes the game board state for 'check', then reverts the game board.
-    // Input:   coordinates from - Starting X,Y position of the chess board to check.
-    //          coordinates to - Destination X,Y position of the requested move.
-    //          color c - The color of the active player.
-    // Output:  Returns TRUE if the destination coordinates would put the active player in check.
-    // Caller:  chessGame::isValidMove();
-    //
-    void setKingPosition(coordinates, color);
-    // Purpose: Sets the current X,Y position of a KING piece of a specific color
-    // Input:   coordinates pos - X,Y position of the KING
-    //          color c - Color of the KING piece to store data for.
-    // Output:  None.
-    // Caller:  chessLogic::getKing();
-    //
-    void queryValidPawnMoves(coordinates, color, vector<coordinates>*);
-    // Purpose: Adds all legal moves for a PAWN piece at X,Y coordinates to the referenced vector.
-    // Input:   coordinates from - Starting X,Y position of where the chess piece is.
-    //          color c - Color of the chess piece to query.
-    //          vector<coordinates>* vc - Reference to the coordinate vector to populate with valid moves.
-    // Output:  None.
-    // Caller:  chessLogic::isValidPieceMove(); chessLogic::queryAllMovesByColor(); isPlayerOutOfMoves();
-    //
-    void queryValidRookMoves(coordinates, color, vector<coordinates>*);
-    // Purpose: Adds all legal moves for a ROOK piece at X,Y coordinates to the referenced vector.
-    // Input:   coordinates from - Starting X,Y position of where the chess piece is.
-    //          color c - Color of the chess piece to query.
-    //          vector<coordinates>* vc - Reference to the coordinate vector to populate with valid moves.
-    // Output:  None.
-    // Caller:  chessLogic::isValidPieceMove(); chessLogic::queryAllMovesByColor(); isPlayerOutOfMoves();
-    //
-    void queryValidKnightMoves(coordinates, color, vector<coordinates>*);
-    // Purpose: Adds all legal moves for a KNIGHT piece at X,Y coordinates to the referenced vector.
-    // Input:   coordinates from - Starting X,Y position of where the chess piece is.
-    //          color c - Color of the chess piece to query.
-    //          vector<coordinates>* vc - Reference to the coordinate vector to populate with valid moves.
-    // Output:  None.
-    // Caller:  chessLogic::isValidPieceMove(); chessLogic::queryAllMovesByColor(); isPlayerOutOfMoves();
-    //
-    void queryValidBishopMoves(coordinates, color, vector<coordinates>*);
-    // Purpose: Adds all legal moves for a BISHOP piece at X,Y coordinates to the referenced vector.
-    // Input:   coordinates from - Starting X,Y position of where the chess piece is.
-    //          color c - Color of the chess piece to query.
-    //          vector<coordinates>* vc - Reference to the coordinate vector to populate with valid moves.
-    // Output:  None.
-    // Caller:  chessLogic::isValidPieceMove(); chessLogic::queryAllMovesByColor(); isPlayerOutOfMoves();
-    //
-    void queryValidQueenMoves(coordinates, color);
-    // Purpose: Adds all legal moves for a QUEEN piece at X,Y coordinates to the referenced vector.
-    //          As a Queen's movement is the Rook + Bishop combined, this method calls those two methods.
-    //          Populates the availableMoves coordinate vector specifically.
-    // Input:   coordinates from - Starting X,Y position of where the chess piece is.
-    //          color c - Color of the chess piece to query.
-    //          
-    // Output:  None.
-    // Caller:  chessLogic::isValidPieceMove();
-    //
-    void queryValidKingMoves(coordinates, color, vector<coordinates>*);
-    // Purpose: Adds all legal moves for a KING piece at X,Y coordinates to the referenced vector.
-    // Input:   coordinates from - Starting X,Y position of where the chess piece is.
-    //          color c - Color of the chess piece to query.
-    //          vector<coordinates>* vc - Reference to the coordinate vector to populate with valid moves.
-    // Output:  None.
-    // Caller:  chessLogic::isValidPieceMove(); chessLogic::queryAllMovesByColor(); isPlayerOutOfMoves();
-    //
-    void queryAllMovesByColor(color);
-    // Purpose: Queries all legal moves for all pieces controlled by a specific color.
-    //          Populates the colorMoves coordinate vector when called.
-    // Input:   color c - Color of the pieces to query.
-    // Output:  None.
-    // Caller:  chessLogic::isPlayerinCheck();
-    //
-    chessTile getKing(color);
-    // Purpose: Returns the chessTile object that contains the KING piece of a specific color.
-    // Input:   color c - Color of KING piece to retrieve.
-    // Output:  chessTile tile - The chessTile object that contains the KING.
-    // Caller:  chessLogic::isPlayerinCheck();
-    //
-    coordinates getKingPosition(color);
-    // Purpose: Returns the X,Y position of the KING piece of a specific color.
-    // Input:   color c - Color of KING piece to retrieve coordinates for.
-    // Output:  wKingPos  or bKingPos - X,Y coordinates of WHITE or BLACK KING.
-    // Caller:  chessLogic::isPlayerinCheck();
-    //
-    bool isPlayerInCheck(color);
-    // Purpose: Checks whether the current board state results in the player of a specific color being in 'Check'.
-    // Input:   color c - Color of player to check for whether they are in 'Check' or not.
-    // Output:  Returns TRUE if the current board state puts the player in check, FALSE if not.
-    // Caller:  chessLogic::isMoveCheckForKing; chessGame::loopGameplay();
-    //
-    bool isPlayerOutOfMoves(color);
-    // Purpose: Checks whether a player of a specific color has any valid moves left to perform.
-    //          Basically used to determine if the game is in CHECKMATE or STALEMATE.
-    //          Does this by simulating all potential moves a player can make, and comparing that
-    //          Against the number of potential moves that would put that same player in check.
-    // Input:   color c - Color of player to check for whether they have any valid moves left.
-    // Output:  Returns TRUE if all potential moves the player can make would put them in 'Check'.
-    // Caller:  chessGame::loopGameplay();
-    //
-    
-private:
-    chessTile (*boardRef)[8][8] = {};
-    // Holds reference the 8x8 chess board from chessGame.
-    color *colorRef = NULL;
-    // Holds reference to the current active player.
-    color *checkRef = NULL;
-    // Holds reference to the current player in 'check', if any.
-    vector<coordinates> availableMoves;
-    // Holds any valid destination coordinates a specific piece can move to.
-    vector<coordinates> colorMoves;
-    // Holds any valid destination coordinates all pieces of a specific color can move to.
-    coordinates wKingPos, bKingPos;
-    // Holds the X,Y positions of the WHITE and BLACK KING pieces respectively. 
-};
-
-#endif /* CHESSLOGIC_H */
-
+/*      Author: Drew Tibbetts
+ *      Creation Date: 6/22/2019
+ *      Modification: 10/19/2026
+ *      FileName: chessLogic.h
+ *      Purpose: Handles all the game play logic needed to conduct a game of 2-player chess.
+ *               Communicates externally with the chessGame object.  Most methods are called externally by
+ *               the chessGame class.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ * 
+ */
+
+#ifndef CHESSLOGIC_H
+#define CHESSLOGIC_H
+#include <cstdlib>
+#include <string>
+#include <cstdint>
+#include <vector>
+#include <exception>
+#include "globals.h"
+#include "chessTile.h"
+#include "chessPiece.h"
+#include "chessInterface.h"
+
+#include <iostream> // debug tests
+
+using namespace std;
+
+struct moveUndo {chessMove move; chessTile movedPiece; chessTile capturedPiece; coordinates capturedAt; boardRights rights;};
+// Everything chessLogic::unmakeMove() needs to take back a move made by chessLogic::makeMove().
+enum moveKind{CAPTURE_MOVES = 1, QUIET_MOVES = 2, ALL_MOVES = 3};
+// Flags for the kinds of move chessLogic::generateLegalMoves() adds. Captures include en passant and capturing
+// promotions, quiet moves include castling and the other promotions.
+
+class chessLogic {
+  
+public:
+    
+    chessLogic();
+    // Purpose: Default constructor. Empty.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  None; 
+    //
+    chessLogic(chessTile (*ptr)[8][8], color*, color*, boardRights*);
+    // Purpose: Overloaded constructor. Receives the game board and state as pointer references.
+    // Input:   chessTile (*ptr)[8][8] - Reference to the 8x8 chessBoard for used for game play.
+    //          color* c - Reference to the current active player, WHITE OR BLACK.
+    //          color* ck - Reference to the current player if any that is in 'check'.
+    //          boardRights* r - Reference to the castling rights and en passant square of the position.
+    // Output:  None.
+    // Caller:  chessGame::resetGame(); 
+    // 
+    chessTile getTile(coordinates);
+    // Purpose: Returns the specific chess tile and any piece data at that tile of X,Y position on the game board.
+    // Input:   coordinates c - X,Y position of the chess board to get the piece from.
+    // Output:  Returns the specific chessTile object at X,Y position.
+    // Caller:  Various chessLogic methods. 
+    // 
+    bool isValidPiece(coordinates);
+    // Purpose: Checks whether the given starting X,Y coordinates on the chess board contain a chess piece.
+    // Input:   coordinates coords - X,Y position of the chess board to check.
+    // Output:  Returns TRUE if space is occupied by a valid chess piece, otherwise returns FALSE.
+    // Caller:  chessGame::isValidMove();
+    // 
+    bool isPlayerPiece(coordinates, color);
+    // Purpose: Checks whether the starting given X,Y coordinates on the chess board contain a chess piece
+    //          controlled by the current active player.
+    // Input:   coordinates coords - X,Y position of the chess board to check.
+    //          color playerColor - Color of the active player.
+    // Output:  Returns TRUE if space is occupied by a chess piece the active player controls.
+    // Caller:  chessGame::isValidMove();
+    // 
+    bool isPlayerDestination(coordinates, color);
+    // Purpose: Checks whether the given destination X,Y coordinates on the chess board contain a chess piece
+    //          controlled by the current active player.
+    // Input:   coordinates coords - X,Y position of the chess board to check.
+    //          color playerColor - Color of the active player.
+    // Output:  Returns TRUE if space is occupied by a chess piece the active player controls.
+    // Caller:  chessGame::isValidMove();
+    // 
+    bool isValidPieceMove(coordinates, coordinates);
+    // Purpose: Checks whether chess piece at starting coordinates can legally perform the move at the 
+    //          destination coordinates.  Knight and sliding piece moves are checked by their geometry and
+    //          the squares in between, pawn and king moves by querying that piece's moves.
+    // Input:   coordinates from - Starting X,Y position of the chess board to check.
+    //          coordinates to - Destination X,Y position of the requested move.
+    // Output:  Returns TRUE if the destination coordinates is a valid legal move for the chess piece.
+    // Caller:  chessGame::isValidMove();
+    // 
+    void makeMove(chessMove, moveUndo*);
+    // Purpose: Plays a move on the board, including the rook of a castling move, the pawn taken en passant and
+    //          the piece a pawn promotes to, and updates the castling rights and en passant square.
+    //          Does not check legality and does not change the active player.
+    // Input:   chessMove move - The move to play. A pawn reaching the last row without a promotion becomes a QUEEN.
+    //          moveUndo* undo - Receives what is needed to take the move back.
+    // Output:  None.
+    // Caller:  chessLogic::isMoveCheckForKing(); chessLogic::perft(); chessGame::doMove(); chessNotation::writeMove();
+    //
+    void unmakeMove(const moveUndo&);
+    // Purpose: Takes back a move made by makeMove(), restoring the board, castling rights and en passant square.
+    // Input:   const moveUndo& undo - The record filled by makeMove(). Moves must be taken back in reverse order.
+    // Output:  None.
+    // Caller:  chessLogic::isMoveCheckForKing(); chessLogic::perft(); chessGame::perft(); chessNotation::writeMove();
+    //
+    bool isSquareAttacked(coordinates, color);
+    // Purpose: Checks whether any piece of a color attacks a square, by looking outward from the square along
+    //          the lines pieces attack on, without generating any moves.
+    // Input:   coordinates sq - X,Y position of the square.
+    //          color attacker - Color of the attacking pieces.
+    // Output:  Returns TRUE if the square is attacked.
+    // Caller:  chessLogic::queryValidKingMoves();
+    //
+    int staticExchange(chessMove);
+    // Purpose: Static exchange evaluation of a capture: plays out every capture and recapture on the target square,
+    //          each side always taking with its least valuable piece and free to stop when going on would lose.
+    //          Pieces lined up behind a capturing slider join in once it has moved, as x-rays.  Pins are ignored.
+    // Input:   chessMove move - The capture, including en passant and capturing promotions.
+    // Output:  int gain - Material the side making the move wins, in centipawns, negative if it loses material.
+    // Caller:  chessMovePicker::isLosingCapture();
+    //
+    bool isMoveCheckForKing(coordinates, coordinates, color);
+    // Purpose: Checks whether the requested move would result in putting the active player into check.
+    //          Simulates the move, analyzes the game board state for 'check', then reverts the game board.
+    // Input:   coordinates from - Starting X,Y position of the chess board to check.
+    //          coordinates to - Destination X,Y position of the requested move.
+    //          color c - The color of the active player.
+    // Output:  Returns TRUE if the destination coordinates would put the active player in check.
+    // Caller:  chessGame::isValidMove();
+    //
+    void setKingPosition(coordinates, color);
+    // Purpose: Sets the current X,Y position of a KING piece of a specific color
+    // Input:   coordinates pos - X,Y position of the KING
+    //          color c - Color of the KING piece to store data for.
+    // Output:  None.
+    // Caller:  chessLogic::getKing(); chessLogic::makeMove(); chessLogic::unmakeMove();
+    //
+    void queryValidPawnMoves(coordinates, color, vector<coordinates>*);
+    // Purpose: Adds all legal moves for a PAWN piece at X,Y coordinates to the referenced vector.
+    //          Includes an en passant capture onto the en passant square.  A move to the last row is a promotion.
+    // Input:   coordinates from - Starting X,Y position of where the chess piece is.
+    //          color c - Color of the chess piece to query.
+    //          vector<coordinates>* vc - Reference to the coordinate vector to populate with valid moves.
+    // Output:  None.
+    // Caller:  chessLogic::isValidPieceMove(); chessLogic::queryAllMovesByColor(); isPlayerOutOfMoves();
+    //
+    void queryValidRookMoves(coordinates, color, vector<coordinates>*);
+    // Purpose: Adds all legal moves for a ROOK piece at X,Y coordinates to the referenced vector.
+    // Input:   coordinates from - Starting X,Y position of where the chess piece is.
+    //          color c - Color of the chess piece to query.
+    //          vector<coordinates>* vc - Reference to the coordinate vector to populate with valid moves.
+    // Output:  None.
+    // Caller:  chessLogic::isValidPieceMove(); chessLogic::queryAllMovesByColor(); isPlayerOutOfMoves();
+    //
+    void queryValidKnightMoves(coordinates, color, vector<coordinates>*);
+    // Purpose: Adds all legal moves for a KNIGHT piece at X,Y coordinates to the referenced vector.
+    // Input:   coordinates from - Starting X,Y position of where the chess piece is.
+    //          color c - Color of the chess piece to query.
+    //          vector<coordinates>* vc - Reference to the coordinate vector to populate with valid moves.
+    // Output:  None.
+    // Caller:  chessLogic::isValidPieceMove(); chessLogic::queryAllMovesByColor(); isPlayerOutOfMoves();
+    //
+    void queryValidBishopMoves(coordinates, color, vector<coordinates>*);
+    // Purpose: Adds all legal moves for a BISHOP piece at X,Y coordinates to the referenced vector.
+    // Input:   coordinates from - Starting X,Y position of where the chess piece is.
+    //          color c - Color of the chess piece to query.
+    //          vector<coordinates>* vc - Reference to the coordinate vector to populate with valid moves.
+    // Output:  None.
+    // Caller:  chessLogic::isValidPieceMove(); chessLogic::queryAllMovesByColor(); isPlayerOutOfMoves();
+    //
+    void queryValidQueenMoves(coordinates, color);
+    // Purpose: Adds all legal moves for a QUEEN piece at X,Y coordinates to the referenced vector.
+    //          As a Queen's movement is the Rook + Bishop combined, this method calls those two methods.
+    //          Replaces the contents of the availableMoves coordinate vector specifically.
+    // Input:   coordinates from - Starting X,Y position of where the chess piece is.
+    //          color c - Color of the chess piece to query.
+    //          
+    // Output:  None.
+    // Caller:  chessLogic::isValidPieceMove();
+    //
+    void queryValidKingMoves(coordinates, color, vector<coordinates>*);
+    // Purpose: Adds all legal moves for a KING piece at X,Y coordinates to the referenced vector.
+    //          Includes castling, as a move of two files, while the right is held, the squares between king and
+    //          rook are empty and the king neither stands on nor crosses an attacked square.
+    // Input:   coordinates from - Starting X,Y position of where the chess piece is.
+    //          color c - Color of the chess piece to query.
+    //          vector<coordinates>* vc - Reference to the coordinate vector to populate with valid moves.
+    // Output:  None.
+    // Caller:  chessLogic::isValidPieceMove(); chessLogic::queryAllMovesByColor(); isPlayerOutOfMoves();
+    //
+    void queryAllMovesByColor(color);
+    // Purpose: Queries all legal moves for all pieces controlled by a specific color.
+    //          Populates the colorMoves coordinate vector when called.
+    // Input:   color c - Color of the pieces to query.
+    // Output:  None.
+    // Caller:  chessLogic::isPlayerinCheck();
+    //
+    chessTile getKing(color);
+    // Purpose: Searches the board for the KING piece of a specific color and remembers its position.
+    // Input:   color c - Color of KING piece to retrieve.
+    // Output:  chessTile tile - The chessTile object that contains the KING, an empty tile if there is none.
+    // Caller:  chessLogic::getKingSquare();
+    //
+    coordinates getKingPosition(color);
+    // Purpose: Returns the X,Y position of the KING piece of a specific color.
+    // Input:   color c - Color of KING piece to retrieve coordinates for.
+    // Output:  wKingPos  or bKingPos - X,Y coordinates of WHITE or BLACK KING.
+    // Caller:  chessLogic::isPlayerinCheck();
+    //
+    bool isPlayerInCheck(color);
+    // Purpose: Checks whether the current board state results in the player of a specific color being in 'Check',
+    //          by looking outward from the KING for an attacking piece.
+    // Input:   color c - Color of player to check for whether they are in 'Check' or not.
+    // Output:  Returns TRUE if the current board state puts the player in check, FALSE if not.
+    // Caller:  chessLogic::isMoveCheckForKing; chessGame::loopGameplay();
+    //
+    void generateLegalMoves(color, vector<chessMove>*, moveKind = ALL_MOVES);
+    // Purpose: Adds every legal move of a color to the referenced vector, with one move per promotion piece.
+    //          Moves of other kinds than requested are skipped before their legality is checked.
+    // Input:   color c - Color of the player to move.
+    //          vector<chessMove>* moves - Reference to the move vector to populate.
+    //          moveKind kinds - The kinds of move to add, ALL_MOVES by default.
+    // Output:  None.
+    // Caller:  chessLogic::perft(); chessGame::perft(); chessMovePicker::next();
+    //
+    uint64_t perft(int);
+    // Purpose: Counts the leaf nodes of the legal move tree of the active player to a fixed depth.  Used to
+    //          verify move generation against the published node counts of test positions.
+    // Input:   int depth - Number of plies to look ahead.
+    // Output:  uint64_t nodes - Number of move sequences of exactly that length.
+    // Caller:  chessGame::perft();
+    //
+    bool isPlayerOutOfMoves(color);
+    // Purpose: Checks whether a player of a specific color has any valid moves left to perform.
+    //          Basically used to determine if the game is in CHECKMATE or STALEMATE.
+    //          Does this by simulating the potential moves a player can make one at a time, and stops
+    //          at the first one that does not put that same player in check.
+    // Input:   color c - Color of player to check for whether they have any valid moves left.
+    // Output:  Returns TRUE if all potential moves the player can make would put them in 'Check'.
+    // Caller:  chessGame::loopGameplay();
+    //
+
+private:
+    // The public methods that take a color dispatch once to these versions for WHITE or BLACK, so the pawn
+    // direction, start and promotion rows and the opponent are constants inside the generation loops.
+    template<color Us> void queryPawnMoves(coordinates, vector<coordinates>*);
+    // Purpose: Adds all legal moves for a PAWN piece of color Us to the referenced vector.
+    // Input:   coordinates from - Starting X,Y position of where the chess piece is.
+    //          vector<coordinates>* vc - Reference to the coordinate vector to populate with valid moves.
+    // Output:  None.
+    // Caller:  chessLogic::queryValidPawnMoves(); chessLogic::queryMovesByColor(); chessLogic::generateMoves();
+    //
+    template<color Us> void queryMovesByColor(vector<coordinates>*);
+    // Purpose: Adds the moves of every piece of color Us to the referenced vector.
+    // Input:   vector<coordinates>* vc - Reference to the coordinate vector to populate with valid moves.
+    // Output:  None.
+    // Caller:  chessLogic::queryAllMovesByColor();
+    //
+    template<color Them> bool isSquareAttackedBy(coordinates);
+    // Purpose: Checks whether any piece of color Them attacks a square.
+    // Input:   coordinates sq - X,Y position of the square.
+    // Output:  Returns TRUE if the square is attacked.
+    // Caller:  chessLogic::isSquareAttacked(); chessLogic::isKingInCheck();
+    //
+    template<color Us> coordinates getKingSquare();
+    // Purpose: Returns the X,Y position of the KING of color Us, as kept up to date by makeMove() and
+    //          unmakeMove().  The board is only searched if the KING is no longer on that square.
+    // Input:   None.
+    // Output:  wKingPos or bKingPos, -1,-1 if there is no KING.
+    // Caller:  chessLogic::getKingPosition(); chessLogic::isKingInCheck();
+    //
+    template<color Us> bool isKingInCheck();
+    // Purpose: Checks whether the KING of color Us is attacked.
+    // Input:   None.
+    // Output:  Returns TRUE if the player of color Us is in check.
+    // Caller:  chessLogic::isPlayerInCheck(); chessLogic::isMoveIntoCheck();
+    //
+    template<color Us> bool isMoveIntoCheck(coordinates, coordinates);
+    // Purpose: Simulates a move of color Us and checks whether it leaves its own KING in check.
+    // Input:   coordinates from - Starting X,Y position of the move.
+    //          coordinates to - Destination X,Y position of the move.
+    // Output:  Returns TRUE if the move would put the player in check.
+    // Caller:  chessLogic::isMoveCheckForKing(); chessLogic::generateMoves();
+    //
+    template<color Us> void generateMoves(vector<chessMove>*, moveKind);
+    // Purpose: Adds the legal moves of color Us of the requested kinds to the referenced vector.
+    // Input:   vector<chessMove>* moves - Reference to the move vector to populate.
+    //          moveKind kinds - The kinds of move to add.
+    // Output:  None.
+    // Caller:  chessLogic::generateLegalMoves();
+    //
+    chessPieceType findLeastAttacker(coordinates, color, uint64_t, coordinates*);
+    // Purpose: Finds the least valuable piece of a color attacking a square, treating some squares as empty.
+    // Input:   coordinates sq - X,Y position of the square.
+    //          color side - Color of the attacking pieces.
+    //          uint64_t removed - Squares to treat as empty, bit x*8+y for square x,y.
+    //          coordinates* at - Receives the position of the attacker.
+    // Output:  chessPieceType type - Type of the attacker, NOPIECE if there is none.
+    // Caller:  chessLogic::staticExchange();
+    //
+    bool isLineClear(coordinates, coordinates);
+    // Purpose: Checks that the squares strictly between two squares on the same row, column or diagonal are empty.
+    // Input:   coordinates from - First square.
+    //          coordinates to - Last square.
+    // Output:  Returns TRUE if nothing stands in between.
+    // Caller:  chessLogic::isValidPieceMove();
+    //
+
+    chessTile (*boardRef)[8][8] = {};
+    // Holds reference the 8x8 chess board from chessGame.
+    color *colorRef = NULL;
+    // Holds reference to the current active player.
+    color *checkRef = NULL;
+    // Holds reference to the current player in 'check', if any.
+    boardRights *rightsRef = NULL;
+    // Holds reference to the castling rights and en passant square of the position.
+    vector<coordinates> availableMoves;
+    // Holds any valid destination coordinates a specific piece can move to.
+    vector<coordinates> colorMoves;
+    // Holds any valid destination coordinates all pieces of a specific color can move to.
+    vector<coordinates> pieceMoves;
+    // Holds the destination coordinates of one piece at a time while checking whether a player is out of moves.
+    vector<vector<chessMove>> perftMoves;
+    // Holds the legal moves of each ply of a perft() run, reused between nodes.
+    coordinates wKingPos = {-1, -1}, bKingPos = {-1, -1};
+    // Holds the X,Y positions of the WHITE and BLACK KING pieces respectively, -1,-1 until first found. 
+};
+
+#endif /* CHESSLOGIC_H */
+
@@ -0,0 +1,208 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessMoveLog.cpp
+ *      Purpose: Move history of a game with board checkpoints, for jumping to any ply.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ *
+ */
+
+#include "chessMoveLog.h"
+#include <cstring>
+#include "chessHash.h"
+
+namespace {
+
+    // first position of a saved log: the board with each square holding the piece type plus 8 times its
+    // color, or 0xFF when empty, like a game snapshot, then the side to move, rights and number of plies
+    struct savedStart {
+        uint8_t board[64];
+        uint8_t player, castling;
+        int8_t enPassantX, enPassantY;
+        int32_t halfmoveClock;
+        int32_t length;
+    };
+    // one saved ply: its hash, halfmove clock, state and check, and its move as square numbers, 0xFF if none
+    struct savedPly {
+        uint64_t hash;
+        int32_t halfmoveClock;
+        uint8_t from, to, promotion, state, inCheck, reserved[3];
+    };
+}
+
+chessMoveLog::chessMoveLog() {
+}
+
+void chessMoveLog::start(chessTile (*ptr)[8][8], color player, boardRights rights, loggedPosition position){
+    positions.clear();
+    checkpoints.clear();
+    position.move = {{-1, -1}, {-1, -1}, NOPIECE};
+    positions.push_back(position);
+    checkpoints.emplace_back();
+    boardCheckpoint& checkpoint = checkpoints.back();
+    for(int i = 0; i < 8; i++){
+        for(int j = 0; j < 8; j++){
+            checkpoint.board[i][j] = (*ptr)[i][j];
+        }
+    }
+    checkpoint.player = player;
+    checkpoint.rights = rights;
+}
+
+void chessMoveLog::record(int ply, chessTile (*ptr)[8][8], color player, boardRights rights, loggedPosition position){
+    // playing on from an earlier ply starts a new line, the old continuation is gone
+    positions.resize(ply + 1);
+    checkpoints.resize(ply / checkpointInterval + 1);
+    positions.push_back(position);
+
+    if((ply + 1) % checkpointInterval == 0){
+        checkpoints.emplace_back();
+        boardCheckpoint& checkpoint = checkpoints.back();
+        for(int i = 0; i < 8; i++){
+            for(int j = 0; j < 8; j++){
+                checkpoint.board[i][j] = (*ptr)[i][j];
+            }
+        }
+        checkpoint.player = player;
+        checkpoint.rights = rights;
+    }
+}
+
+void chessMoveLog::restore(int ply, chessTile (*ptr)[8][8], color* player, boardRights* rights, chessLogic* logic){
+    const boardCheckpoint& checkpoint = checkpoints[ply / checkpointInterval];
+    for(int i = 0; i < 8; i++){
+        for(int j = 0; j < 8; j++){
+            (*ptr)[i][j] = checkpoint.board[i][j];
+        }
+    }
+    *player = checkpoint.player;
+    *rights = checkpoint.rights;
+
+    // the moves after the checkpoint were legal when played, so they are replayed without any checks
+    moveUndo undo;
+    for(int i = ply - ply % checkpointInterval + 1; i <= ply; i++){
+        logic->makeMove(positions[i].move, &undo);
+        *player = (*player == WHITE) ? BLACK : WHITE;
+    }
+}
+
+int chessMoveLog::getLength(){
+    return positions.size();
+}
+
+const loggedPosition& chessMoveLog::getPosition(int ply){
+    return positions[ply];
+}
+
+void chessMoveLog::save(string* out){
+    const boardCheckpoint& first = checkpoints.at(0);
+    savedStart saved = {};
+    for(int i = 0; i < 64; i++){
+        pieceData piece = chessTile(first.board[i / 8][i % 8]).getActivePiece();
+        saved.board[i] = (piece.pieceType == NOPIECE) ? 0xFF : piece.pieceType + 8 * piece.pieceColor;
+    }
+    saved.player = first.player;
+    saved.castling = first.rights.castling;
+    saved.enPassantX = first.rights.enPassant.posX;
+    saved.enPassantY = first.rights.enPassant.posY;
+    saved.halfmoveClock = first.rights.halfmoveClock;
+    saved.length = positions.size();
+    out->append(reinterpret_cast<const char*>(&saved), sizeof(saved));
+    
+    for(size_t i = 0; i < positions.size(); i++){
+        const loggedPosition& position = positions[i];
+        savedPly ply = {};
+        ply.hash = position.hash;
+        ply.halfmoveClock = position.halfmoveClock;
+        ply.from = (position.move.from.posX >= 0) ? position.move.from.posX * 8 + position.move.from.posY : 0xFF;
+        ply.to = (position.move.from.posX >= 0) ? position.move.to.posX * 8 + position.move.to.posY : 0xFF;
+        ply.promotion = position.move.promotion;
+        ply.state = position.state;
+        ply.inCheck = position.inCheck;
+        out->append(reinterpret_cast<const char*>(&ply), sizeof(ply));
+    }
+}
+
+bool chessMoveLog::load(string_view* data, chessTile (*ptr)[8][8], color* player, boardRights* rights, chessLogic* logic){
+    savedStart saved;
+    positions.clear();
+    checkpoints.clear();
+    if(data->size() < sizeof(saved)){
+        return false;
+    }
+    memcpy(&saved, data->data(), sizeof(saved));
+    bool isEnPassantValid = (saved.enPassantX == -1 && saved.enPassantY == -1)
+                         || (saved.enPassantX >= 0 && saved.enPassantX < 8 && saved.enPassantY >= 0 && saved.enPassantY < 8);
+    if(saved.player > BLACK || !isEnPassantValid || saved.halfmoveClock < 0 || saved.length < 1
+       || (data->size() - sizeof(saved)) / sizeof(savedPly) < size_t(saved.length)){
+        return false;
+    }
+    data->remove_prefix(sizeof(saved));
+    
+    // the first position has to be one the rules can work on, with one king of each color
+    int kings[2] = {0, 0};
+    for(int i = 0; i < 64; i++){
+        uint8_t square = saved.board[i];
+        if(square != 0xFF && (square % 8 >= NOPIECE || square / 8 > BLACK)){
+            return false;
+        }
+        if(square != 0xFF && square % 8 == KING){
+            kings[square / 8]++;
+        }
+        (*ptr)[i / 8][i % 8] = (square == 0xFF) ? chessTile() : chessTile(chessPiece(chessPieceType(square % 8), color(square / 8)));
+    }
+    if(kings[WHITE] != 1 || kings[BLACK] != 1){
+        return false;
+    }
+    *player = color(saved.player);
+    *rights = {saved.castling & 15, {saved.enPassantX, saved.enPassantY}, saved.halfmoveClock};
+    
+    // every move is replayed, so the checkpoints are rebuilt and a log that does not add up is caught
+    vector<chessMove> legalMoves;
+    moveUndo undo;
+    for(int i = 0; i < saved.length; i++){
+        savedPly ply;
+        memcpy(&ply, data->data(), sizeof(ply));
+        data->remove_prefix(sizeof(ply));
+        if(ply.state > TIMEOUT || ply.inCheck > NONE){
+            positions.clear();
+            checkpoints.clear();
+            return false;
+        }
+        loggedPosition position = {{{-1, -1}, {-1, -1}, NOPIECE}, ply.hash, ply.halfmoveClock, gameState(ply.state), color(ply.inCheck)};
+        if(i > 0){
+            // a promotion entered without a piece was played as a queen
+            chessMove move = {{ply.from / 8, ply.from % 8}, {ply.to / 8, ply.to % 8}, chessPieceType(ply.promotion)};
+            legalMoves.clear();
+            logic->generateLegalMoves(*player, &legalMoves);
+            bool isLegal = false;
+            for(size_t m = 0; m < legalMoves.size() && !isLegal; m++){
+                const chessMove& legal = legalMoves[m];
+                isLegal = legal.from.posX == move.from.posX && legal.from.posY == move.from.posY && legal.to.posX == move.to.posX
+                       && legal.to.posY == move.to.posY && (legal.promotion == move.promotion || (move.promotion == NOPIECE && legal.promotion == QUEEN));
+            }
+            if(ply.from >= 64 || ply.to >= 64 || ply.promotion > NOPIECE || !isLegal){
+                positions.clear();
+                checkpoints.clear();
+                return false;
+            }
+            position.move = move;
+            logic->makeMove(move, &undo);
+            *player = (*player == WHITE) ? BLACK : WHITE;
+        }
+        if(chessHash::hashBoard(ptr, *player, rights) != ply.hash){
+            positions.clear();
+            checkpoints.clear();
+            return false;
+        }
+        if(i == 0){
+            start(ptr, *player, *rights, position);
+        }
+        else{
+            record(i - 1, ptr, *player, *rights, position);
+        }
+    }
+    return true;
+}
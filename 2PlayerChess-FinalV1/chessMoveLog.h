@@ -0,0 +1,114 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessMoveLog.h
+ *      Purpose: Records every move of a game so any earlier position can be brought back, for reviewing the
+ *               game, taking moves back or trying another line from an earlier point.  Each ply keeps its move,
+ *               hash, halfmove clock and game state; every checkpointInterval plies the whole board is copied as
+ *               well.  Going to a ply restores the checkpoint at or before it and replays the few moves after
+ *               it, so jumping anywhere in a game of any length costs at most checkpointInterval - 1 moves.
+ *      Input: The starting position and every move played, see start() and record().
+ *      Output: The position at any ply, see restore().
+ *      Exceptions: None.
+ *
+ */
+
+#ifndef CHESSMOVELOG_H
+#define CHESSMOVELOG_H
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "globals.h"
+#include "chessTile.h"
+#include "chessLogic.h"
+
+using namespace std;
+
+    struct loggedPosition {chessMove move; uint64_t hash; int halfmoveClock; gameState state; color inCheck;};
+    // One position of a logged game: the move that led to it, from.posX -1 for the first position, its hash and
+    // halfmove clock, the game state after the move and the player in check, if any.
+
+class chessMoveLog {
+public:
+    static const int checkpointInterval = 8;
+    // Plies between two copies of the board.  Restoring a position replays fewer moves than this.
+
+    chessMoveLog();
+    // Purpose: Default constructor. The log is empty until start() is called.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame;
+    //
+    void start(chessTile (*ptr)[8][8], color, boardRights, loggedPosition);
+    // Purpose: Forgets every move and starts logging a new game from its first position.
+    // Input:   chessTile (*ptr)[8][8] - The board of the first position.
+    //          color player - The side to move in it.
+    //          boardRights rights - Its castling rights, en passant square and halfmove clock.
+    //          loggedPosition position - Its hash, state and check; the move is ignored.
+    // Output:  None.
+    // Caller:  chessGame::resetGame(); chessGame::loadPosition(); chessGame::loadSnapshot();
+    //
+    void record(int, chessTile (*ptr)[8][8], color, boardRights, loggedPosition);
+    // Purpose: Logs a move played from a logged ply.  Any plies logged after that ply belonged to another line
+    //          and are dropped first.
+    // Input:   int ply - The ply the move was played from.
+    //          chessTile (*ptr)[8][8] - The board after the move.
+    //          color player - The side to move after the move.
+    //          boardRights rights - The rights after the move.
+    //          loggedPosition position - The move and the position it reached.
+    // Output:  None.
+    // Caller:  chessGame::completeTurn();
+    //
+    void restore(int, chessTile (*ptr)[8][8], color*, boardRights*, chessLogic*);
+    // Purpose: Sets up the position of a logged ply.
+    // Input:   int ply - The ply, from 0 to getLength() - 1.
+    //          chessTile (*ptr)[8][8] - Receives the board.
+    //          color* player - Receives the side to move.
+    //          boardRights* rights - Receives the castling rights, en passant square and halfmove clock.
+    //          chessLogic* logic - Rules working on the same board, player and rights, to replay moves with.
+    // Output:  None.
+    // Caller:  chessGame::jumpToPly();
+    //
+    int getLength();
+    // Purpose: Returns the number of positions logged, one more than the number of moves.
+    // Input:   None.
+    // Output:  int length - Number of positions, 0 before start().
+    // Caller:  chessGame;
+    //
+    const loggedPosition& getPosition(int);
+    // Purpose: Returns what is logged about a ply.
+    // Input:   int ply - The ply, from 0 to getLength() - 1.
+    // Output:  const loggedPosition& position - Its entry, valid until the log changes.
+    // Caller:  chessGame::jumpToPly();
+    //
+    void save(string*);
+    // Purpose: Appends the first position and every logged ply in binary form, in native byte order.
+    // Input:   string* out - Receives the data.
+    // Output:  None.
+    // Caller:  chessGame::saveSnapshot();
+    //
+    bool load(string_view*, chessTile (*ptr)[8][8], color*, boardRights*, chessLogic*);
+    // Purpose: Replaces the log with data written by save(), replaying every move to rebuild the checkpoints.
+    //          Each move has to be legal and lead to the position hash it was logged with.
+    // Input:   string_view* data - The data. The bytes read are removed from its front.
+    //          chessTile (*ptr)[8][8] - Receives the board of the last logged ply.
+    //          color* player - Receives the side to move in it.
+    //          boardRights* rights - Receives its castling rights, en passant square and halfmove clock.
+    //          chessLogic* logic - Rules working on the same board, player and rights, to replay moves with.
+    // Output:  Returns FALSE if the data is cut short or inconsistent; the log is then empty.
+    // Caller:  chessGame::loadSnapshot();
+    //
+
+private:
+    struct boardCheckpoint {chessTile board[8][8]; color player; boardRights rights;};
+    // Complete copy of the position at a ply that is a multiple of checkpointInterval.
+
+    vector<loggedPosition> positions;
+    // Every logged position by ply.
+    vector<boardCheckpoint> checkpoints;
+    // Copies of the positions at plies 0, checkpointInterval, 2 * checkpointInterval and so on.
+};
+
+#endif /* CHESSMOVELOG_H */
@@ -0,0 +1,215 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessMovePicker.cpp
+ *      Purpose: Staged, lazily generated move ordering for the search.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ *
+ */
+
+#include "chessMovePicker.h"
+
+namespace {
+
+    const int victimValues[7] = {100, 500, 320, 330, 900, 20000, 100};
+    // value of each chessPieceType for ordering captures. NOPIECE is the pawn taken en passant.
+    const int promotionScore = 1 << 20;
+    // added to quiet promotions, so they come before every move ordered by history
+
+    bool isSameMove(chessMove a, chessMove b){
+        return a.from.posX == b.from.posX && a.from.posY == b.from.posY && a.to.posX == b.to.posX
+            && a.to.posY == b.to.posY && a.promotion == b.promotion;
+    }
+}
+
+chessMovePicker::chessMovePicker() {
+}
+
+chessMovePicker::chessMovePicker(chessLogic* logic, chessTile (*ptr)[8][8], chessArena* arena){
+    logicRef = logic;
+    boardRef = ptr;
+    arenaRef = arena;
+}
+
+void chessMovePicker::start(color c, chessMove hash, const chessMove* killerMoves, const int (*history)[64]){
+    stage = PICK_HASH;
+    isCapturesOnly = false;
+    side = c;
+    hashMove = hash;
+    killers[0] = killerMoves[0];
+    killers[1] = killerMoves[1];
+    killerIndex = 0;
+    pickedCount = 0;
+    historyRef = history;
+    badCaptures.clear();
+    isGenerated = false;
+}
+
+void chessMovePicker::startCaptures(color c){
+    stage = PICK_CAPTURES;
+    isCapturesOnly = true;
+    side = c;
+    hashMove = {{-1, -1}, {-1, -1}, NOPIECE};
+    pickedCount = 0;
+    badCaptures.clear();
+    isGenerated = false;
+}
+
+bool chessMovePicker::next(chessMove* move){
+    for(;;){
+        switch(stage){
+            case PICK_HASH:
+                stage = PICK_CAPTURES;
+                if(hashMove.from.posX >= 0 && isPlayable(hashMove)){
+                    *move = hashMove;
+                    return true;
+                }
+                hashMove.from.posX = -1;
+                break;
+            case PICK_CAPTURES:
+                if(!isGenerated){
+                    generate(CAPTURE_MOVES);
+                }
+                while(pickBest(move)){
+                    if(isPicked(*move)){
+                        continue;
+                    }
+                    // captures that lose material wait until after the quiet moves, or are dropped in quiescence
+                    if(isLosingCapture(*move)){
+                        if(!isCapturesOnly){
+                            badCaptures.push_back(*move);
+                        }
+                        continue;
+                    }
+                    return true;
+                }
+                stage = isCapturesOnly ? PICK_DONE : PICK_KILLERS;
+                isGenerated = false;
+                break;
+            case PICK_KILLERS:
+                // killers are quiet moves that refuted a sibling position, so they often refute this one too
+                while(killerIndex < 2){
+                    chessMove killer = killers[killerIndex++];
+                    if(killer.from.posX == killer.to.posX && killer.from.posY == killer.to.posY){
+                        continue;
+                    }
+                    if(!isPicked(killer) && !isCapture(killer) && isPlayable(killer)){
+                        pickedKillers[pickedCount++] = killer;
+                        *move = killer;
+                        return true;
+                    }
+                }
+                stage = PICK_QUIETS;
+                break;
+            case PICK_QUIETS:
+                if(!isGenerated){
+                    generate(QUIET_MOVES);
+                }
+                while(pickBest(move)){
+                    if(!isPicked(*move)){
+                        return true;
+                    }
+                }
+                stage = PICK_BAD_CAPTURES;
+                current = 0;
+                break;
+            case PICK_BAD_CAPTURES:
+                if(current < badCaptures.size()){
+                    *move = badCaptures[current++];
+                    return true;
+                }
+                stage = PICK_DONE;
+                break;
+            default:
+                return false;
+        }
+    }
+}
+
+bool chessMovePicker::isCapture(chessMove move){
+    if((*boardRef)[move.to.posX][move.to.posY].getControllingPlayer() != NONE){
+        return true;
+    }
+    // a pawn moving diagonally onto an empty square captures en passant
+    return (*boardRef)[move.from.posX][move.from.posY].getActivePiece().pieceType == PAWN && move.from.posY != move.to.posY;
+}
+
+bool chessMovePicker::isPlayable(chessMove move){
+    pieceData piece = (*boardRef)[move.from.posX][move.from.posY].getActivePiece();
+    if(piece.pieceType == NOPIECE || piece.pieceColor != side){
+        return false;
+    }
+    // a pawn reaching the last row must name its promotion, and no other move may
+    bool isPromotion = piece.pieceType == PAWN && (move.to.posX == 0 || move.to.posX == 7);
+    if(isPromotion != (move.promotion != NOPIECE)){
+        return false;
+    }
+    return logicRef->isValidPieceMove(move.from, move.to) && !logicRef->isMoveCheckForKing(move.from, move.to, side);
+}
+
+bool chessMovePicker::isLosingCapture(chessMove move){
+    // taking a piece worth at least the capturing one cannot lose material, whatever the recaptures
+    chessPieceType victim = (*boardRef)[move.to.posX][move.to.posY].getActivePiece().pieceType;
+    chessPieceType attacker = (*boardRef)[move.from.posX][move.from.posY].getActivePiece().pieceType;
+    if(attacker != KING && victimValues[victim] >= victimValues[attacker]){
+        return false;
+    }
+    return logicRef->staticExchange(move) < 0;
+}
+
+bool chessMovePicker::isPicked(chessMove move){
+    if(hashMove.from.posX >= 0 && isSameMove(move, hashMove)){
+        return true;
+    }
+    for(int i = 0; i < pickedCount; i++){
+        if(isSameMove(move, pickedKillers[i])){
+            return true;
+        }
+    }
+    return false;
+}
+
+void chessMovePicker::generate(moveKind kind){
+    moves.clear();
+    current = 0;
+    isGenerated = true;
+    logicRef->generateLegalMoves(side, &moves, kind);
+    scores = arenaRef->allocateArray<int>(moves.size());
+    for(int i = 0; i < moves.size(); i++){
+        chessMove move = moves[i];
+        if(kind == CAPTURE_MOVES){
+            // most valuable victim first, then least valuable attacker
+            chessPieceType victim = (*boardRef)[move.to.posX][move.to.posY].getActivePiece().pieceType;
+            chessPieceType attacker = (*boardRef)[move.from.posX][move.from.posY].getActivePiece().pieceType;
+            scores[i] = victimValues[victim] * 10 - victimValues[attacker] / 10;
+            scores[i] += (move.promotion != NOPIECE) ? victimValues[move.promotion] : 0;
+        }
+        else if(move.promotion != NOPIECE){
+            scores[i] = promotionScore + victimValues[move.promotion];
+        }
+        else{
+            scores[i] = historyRef[move.from.posX * 8 + move.from.posY][move.to.posX * 8 + move.to.posY];
+        }
+    }
+}
+
+bool chessMovePicker::pickBest(chessMove* move){
+    if(current >= moves.size()){
+        return false;
+    }
+    // selection of the best remaining move; most nodes are cut off after a few moves, so sorting the
+    // whole stage would mostly be wasted
+    int best = current;
+    for(int i = current + 1; i < moves.size(); i++){
+        if(scores[i] > scores[best]){
+            best = i;
+        }
+    }
+    *move = moves[best];
+    moves[best] = moves[current];
+    scores[best] = scores[current];
+    current++;
+    return true;
+}
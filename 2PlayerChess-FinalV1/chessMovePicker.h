@@ -0,0 +1,145 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessMovePicker.h
+ *      Purpose: Hands out the legal moves of a search node one at a time, best candidates first, in stages: the
+ *               hash move, then captures by most valuable victim and least valuable attacker, then the killer
+ *               moves of the ply, then the remaining quiet moves by their history score, and last the captures
+ *               that the static exchange evaluation says lose material.  A stage is only
+ *               generated once the previous one is used up, so a node that is cut off by an early move never
+ *               generates the rest.
+ *      Input: The node's side to move, hash move, killers and history table from chessSearch.
+ *      Output: Legal moves, see next().
+ *      Exceptions: None.
+ *
+ */
+
+#ifndef CHESSMOVEPICKER_H
+#define CHESSMOVEPICKER_H
+#include <cstdlib>
+#include <vector>
+#include "globals.h"
+#include "chessTile.h"
+#include "chessLogic.h"
+#include "chessArena.h"
+
+using namespace std;
+
+    enum pickerStage{PICK_HASH, PICK_CAPTURES, PICK_KILLERS, PICK_QUIETS, PICK_BAD_CAPTURES, PICK_DONE};
+    // The stages of a chessMovePicker, in the order they are gone through.
+
+class chessMovePicker {
+public:
+    chessMovePicker();
+    // Purpose: Default constructor. The picker cannot be used until it is constructed with a position.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  None;
+    //
+    chessMovePicker(chessLogic*, chessTile (*ptr)[8][8], chessArena*);
+    // Purpose: Overloaded constructor. Receives the rules and board of the searched position.
+    // Input:   chessLogic* logic - Rules of the game, working on the board, with the side to move as active player.
+    //          chessTile (*ptr)[8][8] - The board of the searched position.
+    //          chessArena* arena - Scratch memory for the move scores, released by the caller after each node.
+    // Output:  None.
+    // Caller:  chessSearch::chessSearch();
+    //
+    void start(color, chessMove, const chessMove*, const int (*)[64]);
+    // Purpose: Starts picking the moves of the current position, from the hash move on.
+    // Input:   color side - The side to move.
+    //          chessMove hashMove - Move to try first, from.posX -1 if none. Skipped unless legal.
+    //          const chessMove* killers - The two killer moves of the ply. Skipped unless legal and quiet.
+    //          const int (*history)[64] - History scores of the side's quiet moves, by from and to square.
+    // Output:  None.
+    // Caller:  chessSearch::alphaBeta();
+    //
+    void startCaptures(color);
+    // Purpose: Starts picking only the captures of the current position that do not lose material, for
+    //          quiescence search.
+    // Input:   color side - The side to move.
+    // Output:  None.
+    // Caller:  chessSearch::quiescence();
+    //
+    bool next(chessMove*);
+    // Purpose: Hands out the next move, generating the next stage when the current one is used up.
+    //          Every legal move is handed out exactly once, except losing captures after startCaptures().
+    // Input:   chessMove* move - Receives the move.
+    // Output:  Returns FALSE once there are no moves left.
+    // Caller:  chessSearch::alphaBeta(); chessSearch::quiescence();
+    //
+    bool isCapture(chessMove);
+    // Purpose: Checks whether a move takes a piece, including en passant.
+    // Input:   chessMove move - The move.
+    // Output:  Returns TRUE if the move is a capture.
+    // Caller:  chessMovePicker; chessSearch::alphaBeta();
+    //
+
+private:
+    bool isPlayable(chessMove);
+    // Purpose: Checks whether a move from elsewhere in the search, a hash or killer move, is legal here.
+    // Input:   chessMove move - The move.
+    // Output:  Returns TRUE if the move is legal in the current position.
+    // Caller:  chessMovePicker::next();
+    //
+    bool isLosingCapture(chessMove);
+    // Purpose: Checks whether a capture loses material once the recaptures are played out.
+    // Input:   chessMove move - The capture.
+    // Output:  Returns TRUE if the static exchange evaluation of the capture is negative.
+    // Caller:  chessMovePicker::next();
+    //
+    bool isPicked(chessMove);
+    // Purpose: Checks whether a move was already handed out by the hash or killer stage.
+    // Input:   chessMove move - The move.
+    // Output:  Returns TRUE if the move must be skipped.
+    // Caller:  chessMovePicker::next();
+    //
+    void generate(moveKind);
+    // Purpose: Generates the moves of the current stage and scores them.
+    // Input:   moveKind kind - CAPTURE_MOVES or QUIET_MOVES.
+    // Output:  None.
+    // Caller:  chessMovePicker::next();
+    //
+    bool pickBest(chessMove*);
+    // Purpose: Hands out the highest scored move of the stage not handed out yet.
+    // Input:   chessMove* move - Receives the move.
+    // Output:  Returns FALSE once the stage is used up.
+    // Caller:  chessMovePicker::next();
+    //
+
+    chessLogic* logicRef = NULL;
+    // Holds reference to the rules of the searched position.
+    chessTile (*boardRef)[8][8] = {};
+    // Holds reference to the board of the searched position.
+    chessArena* arenaRef = NULL;
+    // Holds reference to the scratch memory the move scores are allocated from.
+    pickerStage stage = PICK_DONE;
+    // The stage moves are handed out from.
+    bool isGenerated = false;
+    // Set once the moves of the current stage are generated.
+    bool isCapturesOnly = false;
+    // Set by startCaptures(); the picker stops after the capture stage.
+    color side = WHITE;
+    // The side to move.
+    chessMove hashMove = {{-1, -1}, {-1, -1}, NOPIECE};
+    // The hash move, from.posX -1 if none or not legal.
+    chessMove killers[2] = {};
+    // The killer moves of the ply.
+    int killerIndex = 0;
+    // Number of killer moves looked at so far.
+    chessMove pickedKillers[2] = {};
+    // The killer moves handed out, the first pickedCount of them.
+    int pickedCount = 0;
+    // Number of killer moves handed out.
+    const int (*historyRef)[64] = NULL;
+    // Holds reference to the history scores of the side to move.
+    vector<chessMove> moves;
+    // Moves of the current stage. Reused between nodes of the ply.
+    int* scores = NULL;
+    // Score of each move of the current stage, allocated from the arena.
+    int current = 0;
+    // Number of moves of the current stage handed out.
+    vector<chessMove> badCaptures;
+    // Captures put off until after the quiet moves because they lose material. Reused between nodes of the ply.
+};
+
+#endif /* CHESSMOVEPICKER_H */
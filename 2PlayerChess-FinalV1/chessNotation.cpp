@@ -0,0 +1,424 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessNotation.cpp
+ *      Purpose: Parses and writes moves in Standard Algebraic Notation (e.g. "Nbd2", "exd8=Q+", "O-O").
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None. Unreadable, illegal or ambiguous moves are reported through return values.
+ *
+ */
+
+#include "chessNotation.h"
+#include "chessStats.h"
+
+namespace {
+
+    // returns the piece named by an upper case SAN piece letter, NOPIECE for anything else
+    chessPieceType pieceFromLetter(char c){
+        switch(c){
+            case 'N':
+                return KNIGHT;
+            case 'B':
+                return BISHOP;
+            case 'R':
+                return ROOK;
+            case 'Q':
+                return QUEEN;
+            case 'K':
+                return KING;
+            default:
+                return NOPIECE;
+        }
+    }
+
+    // returns the upper case SAN letter of a piece
+    char letterFromPiece(chessPieceType p){
+        switch(p){
+            case KNIGHT:
+                return 'N';
+            case BISHOP:
+                return 'B';
+            case ROOK:
+                return 'R';
+            case QUEEN:
+                return 'Q';
+            case KING:
+                return 'K';
+            default:
+                return ' ';
+        }
+    }
+
+    // promotion letters are accepted in either case, so coordinate moves like "e7e8q" can be read
+    chessPieceType promotionFromLetter(char c){
+        if(c >= 'a' && c <= 'z'){
+            c = c - 'a' + 'A';
+        }
+        chessPieceType p = pieceFromLetter(c);
+        return (p == KING) ? NOPIECE : p;
+    }
+
+    bool isSuffix(char c){
+        return c == '+' || c == '#' || c == '!' || c == '?' || c == ' ' || c == '\t' || c == '\r';
+    }
+
+    bool isResultToken(string_view token){
+        return token == "1-0" || token == "0-1" || token == "1/2-1/2" || token == "*";
+    }
+
+    // move numbers such as "12." or "12..." come before a move, either as their own token or attached to it
+    void skipMoveNumber(string_view* token){
+        size_t digits = 0;
+        while(digits < token->size() && (*token)[digits] >= '0' && (*token)[digits] <= '9'){
+            digits++;
+        }
+        if(digits > 0 && digits < token->size() && (*token)[digits] == '.'){
+            size_t end = token->find_first_not_of('.', digits);
+            token->remove_prefix((end == string_view::npos) ? token->size() : end);
+        }
+    }
+}
+
+chessNotation::chessNotation() {
+}
+
+// initialize pointer references to the game board, active player and rules
+chessNotation::chessNotation(chessTile (*ptr)[8][8], color* player, chessLogic* logic){
+    boardRef = ptr;
+    playerRef = player;
+    logicRef = logic;
+}
+
+bool chessNotation::parseMove(string_view text, chessMove* move){
+
+    color side = *playerRef;
+    int homeRow = (side == WHITE) ? 7 : 0;
+    int lastRow = (side == WHITE) ? 0 : 7;
+
+    // strip surrounding blanks, check and mate markers and annotations
+    while(!text.empty() && (text.front() == ' ' || text.front() == '\t')){
+        text.remove_prefix(1);
+    }
+    while(!text.empty() && isSuffix(text.back())){
+        text.remove_suffix(1);
+    }
+    if(text.size() < 2){
+        return false;
+    }
+
+    // castling is written as a king move of two files
+    if(text == "O-O" || text == "0-0" || text == "O-O-O" || text == "0-0-0"){
+        coordinates from = {homeRow, 4};
+        coordinates to = {homeRow, (text.size() == 3) ? 6 : 2};
+        pieceData king = (*boardRef)[from.posX][from.posY].getActivePiece();
+        if(king.pieceType != KING || king.pieceColor != side || !canReach(from, to)){
+            return false;
+        }
+        *move = {from, to, NOPIECE};
+        return true;
+    }
+
+    // leading piece letter, pawns have none
+    chessPieceType pieceType = pieceFromLetter(text[0]);
+    if(pieceType != NOPIECE){
+        text.remove_prefix(1);
+    }
+
+    // trailing promotion, either "=Q" or a bare letter after the destination rank
+    chessPieceType promotion = NOPIECE;
+    if(text.size() >= 3 && text[text.size() - 2] == '='){
+        promotion = promotionFromLetter(text.back());
+        if(promotion == NOPIECE){
+            return false;
+        }
+        text.remove_suffix(2);
+    }
+    else if(text.size() >= 3 && text[text.size() - 2] >= '1' && text[text.size() - 2] <= '8'){
+        promotion = promotionFromLetter(text.back());
+        if(promotion == NOPIECE){
+            return false;
+        }
+        text.remove_suffix(1);
+    }
+
+    // destination square is always the last two characters left
+    coordinates to;
+    if(text.size() < 2 || !parseSquare(text.substr(text.size() - 2), &to)){
+        return false;
+    }
+    text.remove_suffix(2);
+
+    // anything in between is the origin file and/or rank, optionally followed by a capture or dash
+    int fromRow = -1, fromColumn = -1;
+    for(size_t i = 0; i < text.size(); i++){
+        char c = text[i];
+        if(c >= 'a' && c <= 'h'){
+            fromColumn = c - 'a';
+        }
+        else if(c >= '1' && c <= '8'){
+            fromRow = '8' - c;
+        }
+        else if(c != 'x' && c != 'X' && c != '-' && c != ':'){
+            return false;
+        }
+    }
+    // a full origin square without a piece letter is coordinate notation and may move any piece
+    bool isCoordinateMove = (pieceType == NOPIECE && fromRow >= 0 && fromColumn >= 0);
+    if(pieceType == NOPIECE && !isCoordinateMove){
+        pieceType = PAWN;
+    }
+
+    // find the one piece that matches the description and can legally reach the destination
+    coordinates from = {-1, -1};
+    int matches = 0;
+    pieceData piece;
+    for(int i = 0; i < 8; i++){
+        if(fromRow >= 0 && i != fromRow){
+            continue;
+        }
+        for(int j = 0; j < 8; j++){
+            if(fromColumn >= 0 && j != fromColumn){
+                continue;
+            }
+            piece = (*boardRef)[i][j].getActivePiece();
+            if(piece.pieceColor != side || (!isCoordinateMove && piece.pieceType != pieceType)){
+                continue;
+            }
+            if(canReach({i,j}, to)){
+                from = {i,j};
+                matches++;
+            }
+        }
+    }
+    if(matches != 1){
+        return false;
+    }
+
+    // promotion is only allowed, and required, for a pawn reaching the last row. Unspecified means a queen.
+    bool isPromotion = (*boardRef)[from.posX][from.posY].getActivePiece().pieceType == PAWN && to.posX == lastRow;
+    if(isPromotion && promotion == NOPIECE){
+        promotion = QUEEN;
+    }
+    if(!isPromotion && promotion != NOPIECE){
+        return false;
+    }
+
+    *move = {from, to, promotion};
+    return true;
+}
+
+int chessNotation::writeMove(chessMove move, char* buffer){
+
+    color side = *playerRef;
+    color opponent = (side == WHITE) ? BLACK : WHITE;
+    pieceData piece = (*boardRef)[move.from.posX][move.from.posY].getActivePiece();
+    bool isCapture = (*boardRef)[move.to.posX][move.to.posY].getControllingPlayer() != NONE;
+    int length = 0;
+
+    if(piece.pieceType == KING && (move.to.posY - move.from.posY == 2 || move.from.posY - move.to.posY == 2)){
+        // castling
+        buffer[length++] = 'O';
+        buffer[length++] = '-';
+        buffer[length++] = 'O';
+        if(move.to.posY < move.from.posY){
+            buffer[length++] = '-';
+            buffer[length++] = 'O';
+        }
+    }
+    else if(piece.pieceType == PAWN){
+        // pawn captures always name the origin file
+        if(move.from.posY != move.to.posY){
+            buffer[length++] = 'a' + move.from.posY;
+            buffer[length++] = 'x';
+        }
+        length += writeSquare(move.to, buffer + length);
+        if(move.promotion != NOPIECE){
+            buffer[length++] = '=';
+            buffer[length++] = letterFromPiece(move.promotion);
+        }
+    }
+    else{
+        buffer[length++] = letterFromPiece(piece.pieceType);
+
+        // disambiguate against other pieces of the same type that can also reach the destination
+        bool isAmbiguous = false, sharesColumn = false, sharesRow = false;
+        pieceData other;
+        for(int i = 0; i < 8; i++){
+            for(int j = 0; j < 8; j++){
+                if(i == move.from.posX && j == move.from.posY){
+                    continue;
+                }
+                other = (*boardRef)[i][j].getActivePiece();
+                if(other.pieceColor != side || other.pieceType != piece.pieceType || !canReach({i,j}, move.to)){
+                    continue;
+                }
+                isAmbiguous = true;
+                sharesColumn = sharesColumn || (j == move.from.posY);
+                sharesRow = sharesRow || (i == move.from.posX);
+            }
+        }
+        if(isAmbiguous && (!sharesColumn || sharesRow)){
+            buffer[length++] = 'a' + move.from.posY;
+        }
+        if(isAmbiguous && sharesColumn){
+            buffer[length++] = '8' - move.from.posX;
+        }
+
+        if(isCapture){
+            buffer[length++] = 'x';
+        }
+        length += writeSquare(move.to, buffer + length);
+    }
+
+    // play the move to find out whether it gives check or mate, then take it back
+    moveUndo undo;
+    logicRef->makeMove(move, &undo);
+    *playerRef = opponent;
+    if(logicRef->isPlayerInCheck(opponent)){
+        buffer[length++] = logicRef->isPlayerOutOfMoves(opponent) ? '#' : '+';
+    }
+    *playerRef = side;
+    logicRef->unmakeMove(undo);
+
+    buffer[length] = '\0';
+    return length;
+}
+
+bool chessNotation::parseSquare(string_view text, coordinates* coords){
+    if(text.size() != 2){
+        return false;
+    }
+    char file = text[0];
+    char rank = text[1];
+    if(file >= 'A' && file <= 'H'){
+        file = file - 'A' + 'a';
+    }
+    if(file < 'a' || file > 'h' || rank < '1' || rank > '8'){
+        return false;
+    }
+    // rank 8 is the first row of the board array, rank 1 the last
+    coords->posX = '8' - rank;
+    coords->posY = file - 'a';
+    return true;
+}
+
+int chessNotation::writeSquare(coordinates coords, char* buffer){
+    buffer[0] = 'a' + coords.posY;
+    buffer[1] = '8' - coords.posX;
+    return 2;
+}
+
+bool chessNotation::parseFen(string_view text, chessTile (*ptr)[8][8], color* player, boardRights* rights){
+    
+    // fields are separated by blanks: placement, side to move, castling rights, en passant square, counters
+    string_view fields[4];
+    for(int f = 0; f < 4; f++){
+        size_t start = text.find_first_not_of(" \t");
+        if(start == string_view::npos){
+            return false;
+        }
+        size_t end = text.find_first_of(" \t", start);
+        fields[f] = text.substr(start, (end == string_view::npos) ? string_view::npos : end - start);
+        text.remove_prefix((end == string_view::npos) ? text.size() : end);
+    }
+    
+    // piece placement, from rank 8 down to rank 1, which matches the rows of the board array
+    int row = 0, column = 0, kings[2] = {0, 0};
+    for(size_t i = 0; i < fields[0].size(); i++){
+        char c = fields[0][i];
+        if(c == '/'){
+            if(column != 8 || ++row > 7){
+                return false;
+            }
+            column = 0;
+        }
+        else if(c >= '1' && c <= '8'){
+            for(int n = 0; n < c - '0'; n++){
+                if(column > 7){
+                    return false;
+                }
+                (*ptr)[row][column++] = chessTile();
+            }
+        }
+        else{
+            color side = (c >= 'a' && c <= 'z') ? BLACK : WHITE;
+            chessPieceType piece = pieceFromLetter((side == BLACK) ? c - 'a' + 'A' : c);
+            if(c == 'P' || c == 'p'){
+                piece = PAWN;
+            }
+            if(piece == NOPIECE || column > 7){
+                return false;
+            }
+            kings[side] += (piece == KING) ? 1 : 0;
+            (*ptr)[row][column++] = chessTile(chessPiece(piece, side));
+        }
+    }
+    if(row != 7 || column != 8 || kings[WHITE] != 1 || kings[BLACK] != 1){
+        return false;
+    }
+    
+    if(fields[1] != "w" && fields[1] != "b"){
+        return false;
+    }
+    *player = (fields[1] == "w") ? WHITE : BLACK;
+    
+    // castling rights, the move generator also checks that the king and rook are on their home squares
+    rights->castling = 0;
+    for(size_t i = 0; i < fields[2].size() && fields[2] != "-"; i++){
+        switch(fields[2][i]){
+            case 'K':
+                rights->castling |= WHITE_KINGSIDE;
+                break;
+            case 'Q':
+                rights->castling |= WHITE_QUEENSIDE;
+                break;
+            case 'k':
+                rights->castling |= BLACK_KINGSIDE;
+                break;
+            case 'q':
+                rights->castling |= BLACK_QUEENSIDE;
+                break;
+            default:
+                return false;
+        }
+    }
+    
+    rights->enPassant = {-1, -1};
+    if(fields[3] != "-" && !parseSquare(fields[3], &rights->enPassant)){
+        return false;
+    }
+    
+    // the halfmove clock is optional, the fullmove number is ignored
+    rights->halfmoveClock = 0;
+    size_t start = text.find_first_not_of(" \t");
+    for(size_t i = start; start != string_view::npos && i < text.size() && text[i] >= '0' && text[i] <= '9'; i++){
+        rights->halfmoveClock = rights->halfmoveClock * 10 + (text[i] - '0');
+    }
+    return true;
+}
+
+bool chessNotation::nextMoveToken(string_view* text, string_view* token){
+    while(!text->empty()){
+        size_t start = text->find_first_not_of(" \t\r\n");
+        if(start == string_view::npos){
+            text->remove_prefix(text->size());
+            return false;
+        }
+        size_t end = text->find_first_of(" \t\r\n", start);
+        if(end == string_view::npos){
+            end = text->size();
+        }
+        *token = text->substr(start, end - start);
+        text->remove_prefix(end);
+        skipMoveNumber(token);
+        if(!token->empty() && !isResultToken(*token)){
+            return true;
+        }
+    }
+    return false;
+}
+
+bool chessNotation::canReach(coordinates from, coordinates to){
+    return logicRef->isValidPieceMove(from, to) && !logicRef->isMoveCheckForKing(from, to, *playerRef);
+}
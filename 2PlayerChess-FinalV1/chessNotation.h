@@ -0,0 +1,111 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessNotation.h
+ *      Purpose: Parses and writes moves in Standard Algebraic Notation (e.g. "Nbd2", "exd8=Q+", "O-O").
+ *               Parsing resolves piece and disambiguation against the legal moves of the side to move.
+ *               Works on string views and caller supplied buffers, and never allocates, as it sits on the hot
+ *               path of importing and exporting whole game archives.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None. Unreadable, illegal or ambiguous moves are reported through return values.
+ *
+ */
+
+#ifndef CHESSNOTATION_H
+#define CHESSNOTATION_H
+#include <cstdlib>
+#include <string_view>
+#include "globals.h"
+#include "chessTile.h"
+#include "chessLogic.h"
+
+using namespace std;
+
+class chessNotation {
+public:
+    chessNotation();
+    // Purpose: Default constructor. Empty.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  None;
+    //
+    chessNotation(chessTile (*ptr)[8][8], color*, chessLogic*);
+    // Purpose: Overloaded constructor. Receives the game board, active player and rules as pointer references.
+    // Input:   chessTile (*ptr)[8][8] - Reference to the 8x8 chessBoard.
+    //          color* player - Reference to the current active player, the side whose moves are parsed.
+    //          chessLogic* logic - Reference to the chessLogic object used to generate legal moves.
+    // Output:  None.
+    // Caller:  chessGame::resetGame();
+    //
+    bool parseMove(string_view, chessMove*);
+    // Purpose: Converts a move written in SAN, or in coordinate form ("e2e4", "e7e8q"), into a legal chessMove
+    //          for the active player.  Check, mate and annotation suffixes are accepted and ignored.
+    // Input:   string_view text - The move text.
+    //          chessMove* move - Receives the move when it could be resolved.
+    // Output:  Returns TRUE if the text names exactly one legal move, FALSE if it is unreadable, illegal or
+    //          ambiguous.
+    // Caller:  chessGame::playNotation(); chessGame::handleInput();
+    //
+    int writeMove(chessMove, char*);
+    // Purpose: Writes a legal move of the active player in SAN, with the minimal disambiguation and a '+' or '#'
+    //          suffix.  Must be called before the move is played.
+    // Input:   chessMove move - The move to write.
+    //          char* buffer - Receives the SAN text and a terminating NUL. Must hold at least 10 characters.
+    // Output:  Returns the number of characters written, not counting the NUL.
+    // Caller:  chessGame::playNotation(); chessGame::submitMove(); chessGame::handleInput();
+    //
+    static bool parseSquare(string_view, coordinates*);
+    // Purpose: Converts a two character square name such as "e4" into x,y board coordinates.
+    // Input:   string_view text - The square name, file then rank. Files may be upper or lower case.
+    //          coordinates* coords - Receives the x,y position.
+    // Output:  Returns TRUE if text is a valid square.
+    // Caller:  chessNotation::parseMove();
+    //
+    static int writeSquare(coordinates, char*);
+    // Purpose: Writes the two character name of a square, e.g. "e4".
+    // Input:   coordinates coords - The x,y position of the square.
+    //          char* buffer - Receives the two characters. No NUL is written.
+    // Output:  Returns the number of characters written (2).
+    // Caller:  chessNotation::writeMove(); chessGame::handleInput(); chessGame::perft();
+    //
+    static bool parseFen(string_view, chessTile (*ptr)[8][8], color*, boardRights*);
+    // Purpose: Reads a position in Forsyth-Edwards Notation, e.g.
+    //          "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1".  The move counters are optional;
+    //          the halfmove clock is read, the fullmove number is ignored.
+    // Input:   string_view text - The FEN text.
+    //          chessTile (*ptr)[8][8] - Receives the piece placement.
+    //          color* player - Receives the side to move.
+    //          boardRights* rights - Receives the castling rights, en passant square and halfmove clock.
+    // Output:  Returns FALSE if the text is not a valid FEN position with one king of each color. The outputs
+    //          may have been partly written.
+    // Caller:  chessGame::loadPosition();
+    //
+    static bool nextMoveToken(string_view*, string_view*);
+    // Purpose: Splits the next move out of a line of movetext, skipping move numbers ("12.", "12...") and game
+    //          results ("1-0", "1/2-1/2", "*").
+    // Input:   string_view* text - The remaining movetext. Advanced past the returned move.
+    //          string_view* token - Receives the move text.
+    // Output:  Returns FALSE once no moves are left.
+    // Caller:  chessIndex::indexGame(); main();
+    //
+
+private:
+    bool canReach(coordinates, coordinates);
+    // Purpose: Checks whether the active player's piece at one square can legally move to another.
+    // Input:   coordinates from - Position of the piece.
+    //          coordinates to - Destination of the move.
+    // Output:  Returns TRUE if the move is legal, including not leaving the king in check.
+    // Caller:  chessNotation::parseMove(); chessNotation::writeMove();
+    //
+
+    chessTile (*boardRef)[8][8] = NULL;
+    // Reference to the chessBoard from chessGame.
+    color* playerRef = NULL;
+    // Reference to the current active player from chessGame.
+    chessLogic* logicRef = NULL;
+    // Reference to the chessLogic object of the same game.
+};
+
+#endif /* CHESSNOTATION_H */
+
@@ -0,0 +1,38 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessPawnTable.cpp
+ *      Purpose: Hash table of pawn structure terms for chessSearch.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ *
+ */
+
+#include "chessPawnTable.h"
+
+chessPawnTable::chessPawnTable() {
+    entries.resize(size_t(1) << defaultSizeBits);
+    indexMask = entries.size() - 1;
+    clear();
+}
+
+void chessPawnTable::clear(){
+    // an empty slot holds a key whose low bits point to another slot, so no lookup can ever match it
+    for(size_t i = 0; i < entries.size(); i++){
+        entries[i] = pawnEntry{~uint64_t(i), 0, {}};
+    }
+}
+
+bool chessPawnTable::probe(uint64_t key, pawnEntry* entry){
+    const pawnEntry& slot = entries[key & indexMask];
+    if(slot.key != key){
+        return false;
+    }
+    *entry = slot;
+    return true;
+}
+
+void chessPawnTable::store(const pawnEntry& entry){
+    entries[entry.key & indexMask] = entry;
+}
@@ -0,0 +1,65 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessPawnTable.h
+ *      Purpose: Pawn structure cache for the evaluation.  Pawns move rarely compared to the other pieces, so most
+ *               positions of a search share their pawns with thousands of others.  The structure terms worked out
+ *               for a set of pawns are kept by a hash of the pawns alone, and only a new set of pawns is analysed.
+ *               Each chessSearch owns its table, so lookups need no locking.
+ *      Input: Pawn structures analysed by chessSearch, see store().
+ *      Output: Entries of pawn structures analysed before, see probe().
+ *      Exceptions: None.
+ *
+ */
+
+#ifndef CHESSPAWNTABLE_H
+#define CHESSPAWNTABLE_H
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+#include "globals.h"
+
+using namespace std;
+
+    struct pawnEntry {uint64_t key; int16_t score; int8_t shelter[2][8];};
+    // What is known about a set of pawns: its pawn hash, the passed, isolated, doubled and backward pawn terms
+    // from white's point of view, and for each color and king file the bonus of the pawns sheltering a king there.
+
+class chessPawnTable {
+public:
+    chessPawnTable();
+    // Purpose: Default constructor. Allocates a table of defaultSizeBits.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessSearch::chessSearch();
+    //
+    void clear();
+    // Purpose: Empties every slot.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessSearch::clearTable();
+    //
+    bool probe(uint64_t, pawnEntry*);
+    // Purpose: Looks a set of pawns up.
+    // Input:   uint64_t key - Hash of the pawns, see chessHash::hashPawns().
+    //          pawnEntry* entry - Receives the entry when found.
+    // Output:  Returns TRUE if the pawns have an entry.
+    // Caller:  chessSearch::evaluate();
+    //
+    void store(const pawnEntry&);
+    // Purpose: Records an analysed set of pawns, replacing whatever shared its slot.
+    // Input:   const pawnEntry& entry - The entry, with the pawn hash as its key.
+    // Output:  None.
+    // Caller:  chessSearch::evaluate();
+    //
+
+private:
+    static const int defaultSizeBits = 14;
+    // The table holds 2^defaultSizeBits entries of 32 bytes, 512KB.
+    vector<pawnEntry> entries;
+    // The entries, indexed by the low bits of the key.
+    uint64_t indexMask = 0;
+    // Number of entries minus one.
+};
+
+#endif /* CHESSPAWNTABLE_H */
@@ -0,0 +1,589 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessSearch.cpp
+ *      Purpose: Iterative deepening alpha-beta search and static evaluation for computer players.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ *
+ */
+
+#include "chessSearch.h"
+#include <algorithm>
+#include "chessHash.h"
+#include "chessStats.h"
+
+namespace {
+
+    const int pieceValues[7] = {100, 500, 320, 330, 900, 0, 0};
+    // material value of each chessPieceType, in centipawns
+
+    // piece-square bonuses from white's point of view, row 0 being rank 8 as on the board. Black uses the
+    // mirrored row. Rooks and queens only count their material.
+    const int pawnSquares[8][8] = {
+        { 0,  0,  0,  0,  0,  0,  0,  0},
+        {50, 50, 50, 50, 50, 50, 50, 50},
+        {10, 10, 20, 30, 30, 20, 10, 10},
+        { 5,  5, 10, 25, 25, 10,  5,  5},
+        { 0,  0,  0, 20, 20,  0,  0,  0},
+        { 5, -5,-10,  0,  0,-10, -5,  5},
+        { 5, 10, 10,-20,-20, 10, 10,  5},
+        { 0,  0,  0,  0,  0,  0,  0,  0}
+    };
+    const int knightSquares[8][8] = {
+        {-50,-40,-30,-30,-30,-30,-40,-50},
+        {-40,-20,  0,  0,  0,  0,-20,-40},
+        {-30,  0, 10, 15, 15, 10,  0,-30},
+        {-30,  5, 15, 20, 20, 15,  5,-30},
+        {-30,  0, 15, 20, 20, 15,  0,-30},
+        {-30,  5, 10, 15, 15, 10,  5,-30},
+        {-40,-20,  0,  5,  5,  0,-20,-40},
+        {-50,-40,-30,-30,-30,-30,-40,-50}
+    };
+    const int bishopSquares[8][8] = {
+        {-20,-10,-10,-10,-10,-10,-10,-20},
+        {-10,  0,  0,  0,  0,  0,  0,-10},
+        {-10,  0,  5, 10, 10,  5,  0,-10},
+        {-10,  5,  5, 10, 10,  5,  5,-10},
+        {-10,  0, 10, 10, 10, 10,  0,-10},
+        {-10, 10, 10, 10, 10, 10, 10,-10},
+        {-10,  5,  0,  0,  0,  0,  5,-10},
+        {-20,-10,-10,-10,-10,-10,-10,-20}
+    };
+    const int kingSquares[8][8] = {
+        {-30,-40,-40,-50,-50,-40,-40,-30},
+        {-30,-40,-40,-50,-50,-40,-40,-30},
+        {-30,-40,-40,-50,-50,-40,-40,-30},
+        {-30,-40,-40,-50,-50,-40,-40,-30},
+        {-20,-30,-30,-40,-40,-30,-30,-20},
+        {-10,-20,-20,-20,-20,-20,-20,-10},
+        { 20, 20,  0,  0,  0,  0, 20, 20},
+        { 20, 30, 10,  0,  0, 10, 30, 20}
+    };
+
+    const int passedBonus[8] = {0, 5, 10, 20, 35, 60, 100, 0};
+    // bonus of a passed pawn by how far it has come, 1 being its starting rank
+    const int isolatedPenalty = 12, doubledPenalty = 12, backwardPenalty = 8;
+    // penalties of a pawn without neighbours on either file, of each pawn beyond the first on a file, and of a
+    // pawn left behind its neighbours whose next square is guarded by an enemy pawn
+    const int shelterBonus[3] = {-10, 10, 5};
+    // bonus of each of the three files around a king by its own pawn on them: none or far advanced, on its
+    // starting rank, or one rank ahead
+
+    // works out the pawn structure terms of pawns given as a bit of its row for every pawn, by color and file
+    void scorePawns(const uint8_t (*pawnRows)[8], pawnEntry* entry){
+        int score[2] = {0, 0};
+        for(int c = WHITE; c <= BLACK; c++){
+            const uint8_t* own = pawnRows[c];
+            const uint8_t* enemy = pawnRows[1 - c];
+            for(int f = 0; f < 8; f++){
+                uint8_t neighbours = ((f > 0) ? own[f - 1] : 0) | ((f < 7) ? own[f + 1] : 0);
+                uint8_t enemyNear = enemy[f] | ((f > 0) ? enemy[f - 1] : 0) | ((f < 7) ? enemy[f + 1] : 0);
+                uint8_t enemyBeside = ((f > 0) ? enemy[f - 1] : 0) | ((f < 7) ? enemy[f + 1] : 0);
+                int count = 0;
+                for(int r = 0; r < 8; r++){
+                    if((own[f] & (1 << r)) == 0){
+                        continue;
+                    }
+                    count++;
+                    // white pawns advance towards row 0, black pawns towards row 7
+                    uint8_t ahead = (c == WHITE) ? (1 << r) - 1 : 0xFF & ~((2 << r) - 1);
+                    int advance = (c == WHITE) ? 7 - r : r;
+                    int guardRow = (c == WHITE) ? r - 2 : r + 2;
+                    if(((enemyNear | own[f]) & ahead) == 0){
+                        score[c] += passedBonus[advance];
+                    }
+                    if(neighbours == 0){
+                        score[c] -= isolatedPenalty;
+                    }
+                    else if((neighbours & ~ahead & 0xFF) == 0 && guardRow >= 0 && guardRow < 8 && (enemyBeside & (1 << guardRow))){
+                        score[c] -= backwardPenalty;
+                    }
+                }
+                if(count > 1){
+                    score[c] -= doubledPenalty * (count - 1);
+                }
+                
+                // the shelter of a king on this file, from the pawns on it and the files beside it
+                int shelter = 0;
+                for(int g = max(f - 1, 0); g <= min(f + 1, 7); g++){
+                    int home = (c == WHITE) ? 6 : 1;
+                    int front = (c == WHITE) ? 5 : 2;
+                    shelter += shelterBonus[(own[g] & (1 << home)) ? 1 : (own[g] & (1 << front)) ? 2 : 0];
+                }
+                entry->shelter[c][f] = shelter;
+            }
+        }
+        entry->score = score[WHITE] - score[BLACK];
+    }
+
+    const int infiniteScore = chessSearch::mateScore + 1;
+    const int mateBound = chessSearch::mateScore - 256;
+    // scores beyond this are mates, stored in the transposition table relative to the position instead of the root
+    const chessMove noMove = {{-1, -1}, {-1, -1}, NOPIECE};
+    const int historyLimit = 1 << 16;
+    // history scores are halved once one of them passes this, so they stay below chessMovePicker's promotion bonus
+
+    bool isSameMove(chessMove a, chessMove b){
+        return a.from.posX == b.from.posX && a.from.posY == b.from.posY && a.to.posX == b.to.posX
+            && a.to.posY == b.to.posY && a.promotion == b.promotion;
+    }
+}
+
+chessSearch::chessSearch() : stopRequested(false), isPondering(false) {
+    logic = chessLogic(&board, &sideToMove, &inCheck, &rights);
+    pickers.assign(maxPly, chessMovePicker(&logic, &board, &arena));
+}
+
+void chessSearch::setPosition(chessTile (*ptr)[8][8], color side, boardRights r, const chessHistory& history){
+    for(int i = 0; i < 8; i++){
+        for(int j = 0; j < 8; j++){
+            board[i][j] = (*ptr)[i][j];
+        }
+    }
+    sideToMove = side;
+    inCheck = NONE;
+    rights = r;
+    positions = history;
+    pawnKey = chessHash::hashPawns(&board);
+}
+
+uint64_t chessSearch::playRootMove(chessMove move){
+    moveUndo undo;
+    playMove(move, &undo);
+    return chessHash::hashBoard(&board, sideToMove, &rights);
+}
+
+searchResult chessSearch::search(searchLimits limits){
+    searchResult result = {{{-1, -1}, {-1, -1}, NOPIECE}, 0, 0, 0, {{-1, -1}, {-1, -1}, NOPIECE}};
+    
+    nodes = 0;
+    nodeLimit = limits.nodes;
+    depthLimit = limits.depth;
+    isLimited = !isPondering.load(memory_order_acquire);
+    // killers and history are learned anew for every search
+    for(int i = 0; i < maxPly; i++){
+        killers[i][0] = killers[i][1] = {{0, 0}, {0, 0}, NOPIECE};
+    }
+    for(int c = 0; c < 2; c++){
+        for(int from = 0; from < 64; from++){
+            for(int to = 0; to < 64; to++){
+                history[c][from][to] = 0;
+            }
+        }
+    }
+    stopRequested.store(false, memory_order_relaxed);
+    tableProbes = tableHits = 0;
+    pawnProbes = pawnHits = 0;
+    table.newSearch();
+    if(timeManager != NULL){
+        timeManager->newSearch();
+    }
+    lines.clear();
+    
+    rootMoves.clear();
+    logic.generateLegalMoves(sideToMove, &rootMoves);
+    if(rootMoves.empty()){
+        bool isCheck = logic.isPlayerInCheck(sideToMove);
+        result.score = isCheck ? -mateScore : 0;
+        return result;
+    }
+    result.bestMove = rootMoves[0];
+    
+    // while pondering the depth limit is ignored, a ponder hit then stops the first iteration past it
+    for(iterationDepth = 1; iterationDepth < maxPly; iterationDepth++){
+        bool isTimed = !isPondering.load(memory_order_acquire);
+        if(isTimed && depthLimit != 0 && iterationDepth > depthLimit){
+            break;
+        }
+        if(isTimed && timeManager != NULL && iterationDepth > 1 && !timeManager->isIterationAllowed()){
+            break;
+        }
+        isAborted = false;
+        rootBest = result.bestMove;
+        rootReply = result.ponderMove;
+        rootLines.clear();
+        int score = alphaBeta(iterationDepth, 0, -infiniteScore, infiniteScore);
+        
+        // the first iteration always counts, so there is a move even on the smallest budget
+        if(isAborted && iterationDepth > 1){
+            break;
+        }
+        result.bestMove = rootBest;
+        result.ponderMove = rootReply;
+        if(result.ponderMove.from.posX < 0){
+            // the reply was settled by the table without a search, so the table holds it
+            vector<chessMove> reply;
+            readLine(result.bestMove, 2, &reply);
+            if(reply.size() == 2){
+                result.ponderMove = reply[1];
+            }
+        }
+        result.score = score;
+        result.depth = iterationDepth;
+        lines = rootLines;
+        for(int i = 0; i < lines.size(); i++){
+            readLine(lines[i].moves[0], iterationDepth, &lines[i].moves);
+        }
+        if(timeManager != NULL){
+            timeManager->recordIteration(result.bestMove, score);
+        }
+        if(reporter){
+            result.nodes = nodes;
+            reporter(result);
+        }
+        
+        // a forced mate will not change with more depth, though the other lines still might
+        if(isAborted || (lineCount == 1 && (score >= mateScore - iterationDepth || score <= -mateScore + iterationDepth))){
+            break;
+        }
+    }
+    result.nodes = nodes;
+    chessStats::increment(NODES_SEARCHED, nodes);
+    chessStats::increment(CACHE_PROBES, tableProbes);
+    chessStats::increment(CACHE_HITS, tableHits);
+    chessStats::increment(PAWN_PROBES, pawnProbes);
+    chessStats::increment(PAWN_HITS, pawnHits);
+    arena.reset();
+    return result;
+}
+
+void chessSearch::setReporter(function<void(const searchResult&)> report){
+    reporter = report;
+}
+
+void chessSearch::setLineCount(int count){
+    lineCount = (count > 1) ? count : 1;
+}
+
+void chessSearch::getLines(vector<searchLine>* out){
+    *out = lines;
+}
+
+void chessSearch::clearTable(){
+    table.clear();
+    pawnTable.clear();
+}
+
+void chessSearch::setPondering(bool isOn){
+    isPondering.store(isOn, memory_order_release);
+}
+
+void chessSearch::setTimeManager(chessTimeManager* manager){
+    timeManager = manager;
+}
+
+void chessSearch::stop(){
+    stopRequested.store(true, memory_order_relaxed);
+}
+
+int chessSearch::alphaBeta(int depth, int ply, int alpha, int beta){
+    if(ply == 1){
+        lineReply = {{-1, -1}, {-1, -1}, NOPIECE};
+    }
+    if(ply > 0){
+        // draws by rule: a repeated position could be repeated again, so a single repetition is enough
+        if(rights.halfmoveClock >= 100 || positions.isRepeated()){
+            return 0;
+        }
+        if(isOutOfBudget()){
+            return 0;
+        }
+    }
+    if(depth <= 0 || ply >= maxPly - 1){
+        return quiescence(ply, alpha, beta);
+    }
+    nodes++;
+    
+    // a position searched before to at least this depth may be settled already, and its best move goes first
+    uint64_t key = positions.getLatestHash();
+    chessMove hashMove = (ply == 0) ? rootBest : noMove;
+    transpositionEntry entry;
+    tableProbes++;
+    if(table.probe(key, &entry)){
+        tableHits++;
+        if(ply > 0){
+            hashMove = entry.move;
+            int score = (entry.score > mateBound) ? entry.score - ply : (entry.score < -mateBound) ? entry.score + ply : entry.score;
+            if(entry.depth >= depth && (entry.bound == BOUND_EXACT || (entry.bound == BOUND_LOWER && score >= beta)
+                                        || (entry.bound == BOUND_UPPER && score <= alpha))){
+                return score;
+            }
+        }
+    }
+    
+    // the picker's move scores live in the arena until this node is done
+    arenaMark scope = arena.mark();
+    chessMovePicker& picker = pickers[ply];
+    picker.start(sideToMove, hashMove, killers[ply], history[sideToMove]);
+    
+    moveUndo undo;
+    chessMove move;
+    chessMove bestMove = noMove;
+    int moveCount = 0;
+    int originalAlpha = alpha;
+    int bestScore = -infiniteScore;
+    while(picker.next(&move)){
+        moveCount++;
+        playMove(move, &undo);
+        int score = -alphaBeta(depth - 1, ply + 1, -beta, -alpha);
+        unplayMove(undo);
+        if(isAborted){
+            bestScore = 0;
+            break;
+        }
+        if(score > bestScore){
+            bestScore = score;
+            bestMove = move;
+            // the best reply to the best root move is the move the opponent is expected to play
+            if(ply == 0){
+                rootBest = move;
+                rootReply = lineReply;
+            }
+            else if(ply == 1){
+                lineReply = move;
+            }
+        }
+        // at the root alpha only rises to the score of the last of the best lines, so each of them is exact
+        if(ply == 0){
+            if(score > alpha){
+                alpha = recordRootLine(move, score);
+            }
+        }
+        else if(score > alpha){
+            alpha = score;
+        }
+        if(alpha >= beta){
+            if(!picker.isCapture(move) && move.promotion == NOPIECE){
+                recordCutoff(move, depth, ply);
+            }
+            break;
+        }
+    }
+    arena.release(scope);
+    
+    if(moveCount == 0){
+        bool isCheck = logic.isPlayerInCheck(sideToMove);
+        return isCheck ? -mateScore + ply : 0;
+    }
+    if(!isAborted){
+        scoreBound bound = (bestScore >= beta) ? BOUND_LOWER : (bestScore > originalAlpha) ? BOUND_EXACT : BOUND_UPPER;
+        int stored = (bestScore > mateBound) ? bestScore + ply : (bestScore < -mateBound) ? bestScore - ply : bestScore;
+        table.store(key, (bound == BOUND_UPPER) ? noMove : bestMove, stored, depth, bound);
+    }
+    return bestScore;
+}
+
+int chessSearch::quiescence(int ply, int alpha, int beta){
+    if(isOutOfBudget()){
+        return 0;
+    }
+    nodes++;
+    
+    // the side to move may stand on the static score instead of capturing
+    int standPat = evaluate();
+    if(standPat >= beta || ply >= maxPly - 1){
+        return standPat;
+    }
+    if(standPat > alpha){
+        alpha = standPat;
+    }
+    
+    arenaMark scope = arena.mark();
+    chessMovePicker& picker = pickers[ply];
+    picker.startCaptures(sideToMove);
+    
+    moveUndo undo;
+    chessMove move;
+    while(picker.next(&move)){
+        playMove(move, &undo);
+        int score = -quiescence(ply + 1, -beta, -alpha);
+        unplayMove(undo);
+        if(isAborted){
+            alpha = 0;
+            break;
+        }
+        if(score > alpha){
+            alpha = score;
+        }
+        if(alpha >= beta){
+            break;
+        }
+    }
+    arena.release(scope);
+    return alpha;
+}
+
+int chessSearch::evaluate(){
+    int score = 0;
+    // the material scan visits every pawn anyway, so noting its row there is cheaper than a second scan on a miss
+    uint8_t pawnRows[2][8] = {};
+    coordinates kings[2] = {{-1, -1}, {-1, -1}};
+    for(int i = 0; i < 8; i++){
+        for(int j = 0; j < 8; j++){
+            pieceData piece = board[i][j].getActivePiece();
+            if(piece.pieceType == NOPIECE){
+                continue;
+            }
+            // tables are laid out for white, black reads them upside down
+            int row = (piece.pieceColor == WHITE) ? i : 7 - i;
+            int value = pieceValues[piece.pieceType];
+            switch(piece.pieceType){
+                case PAWN:
+                    value += pawnSquares[row][j];
+                    pawnRows[piece.pieceColor][j] |= 1 << i;
+                    break;
+                case KNIGHT:
+                    value += knightSquares[row][j];
+                    break;
+                case BISHOP:
+                    value += bishopSquares[row][j];
+                    break;
+                case KING:
+                    value += kingSquares[row][j];
+                    kings[piece.pieceColor] = {i, j};
+                    break;
+                default:
+                    break;
+            }
+            score += (piece.pieceColor == sideToMove) ? value : -value;
+        }
+    }
+    
+    pawnEntry pawns;
+    pawnProbes++;
+    if(pawnTable.probe(pawnKey, &pawns)){
+        pawnHits++;
+    }
+    else{
+        scorePawns(pawnRows, &pawns);
+        pawns.key = pawnKey;
+        pawnTable.store(pawns);
+    }
+    // pawns only shelter a king that stays at home
+    int pawnScore = pawns.score;
+    if(kings[WHITE].posX >= 6){
+        pawnScore += pawns.shelter[WHITE][kings[WHITE].posY];
+    }
+    if(kings[BLACK].posX >= 0 && kings[BLACK].posX <= 1){
+        pawnScore -= pawns.shelter[BLACK][kings[BLACK].posY];
+    }
+    return score + ((sideToMove == WHITE) ? pawnScore : -pawnScore);
+}
+
+bool chessSearch::isInsufficientMaterial(){
+    int minorPieces = 0;
+    for(int i = 0; i < 8; i++){
+        for(int j = 0; j < 8; j++){
+            chessPieceType type = board[i][j].getActivePiece().pieceType;
+            if(type == PAWN || type == ROOK || type == QUEEN){
+                return false;
+            }
+            if(type == KNIGHT || type == BISHOP){
+                minorPieces++;
+            }
+        }
+    }
+    return minorPieces <= 1;
+}
+
+int chessSearch::recordRootLine(chessMove move, int score){
+    int i = rootLines.size();
+    while(i > 0 && rootLines[i - 1].score < score){
+        i--;
+    }
+    rootLines.insert(rootLines.begin() + i, searchLine{score, {move}});
+    if(rootLines.size() > lineCount){
+        rootLines.pop_back();
+    }
+    return (rootLines.size() < lineCount) ? -infiniteScore : rootLines.back().score;
+}
+
+void chessSearch::readLine(chessMove move, int length, vector<chessMove>* line){
+    moveUndo undo[maxPly];
+    vector<chessMove> legalMoves;
+    transpositionEntry entry;
+    
+    line->assign(1, move);
+    playMove(move, &undo[0]);
+    while(line->size() < length && !positions.isRepeated() && table.probe(positions.getLatestHash(), &entry)){
+        // the table may have lost the position or hold a collision, so every move is checked against the rules
+        legalMoves.clear();
+        logic.generateLegalMoves(sideToMove, &legalMoves);
+        if(entry.move.from.posX < 0 || find_if(legalMoves.begin(), legalMoves.end(), [&entry](chessMove m){
+                return isSameMove(m, entry.move); }) == legalMoves.end()){
+            break;
+        }
+        playMove(entry.move, &undo[line->size()]);
+        line->push_back(entry.move);
+    }
+    for(int i = line->size() - 1; i >= 0; i--){
+        unplayMove(undo[i]);
+    }
+}
+
+void chessSearch::recordCutoff(chessMove move, int depth, int ply){
+    if(!isSameMove(move, killers[ply][0])){
+        killers[ply][1] = killers[ply][0];
+        killers[ply][0] = move;
+    }
+    // deeper cutoffs say more about a move, so they weigh more
+    int (*table)[64] = history[sideToMove];
+    int& score = table[move.from.posX * 8 + move.from.posY][move.to.posX * 8 + move.to.posY];
+    score += depth * depth;
+    if(score > historyLimit){
+        for(int from = 0; from < 64; from++){
+            for(int to = 0; to < 64; to++){
+                table[from][to] /= 2;
+            }
+        }
+    }
+}
+
+void chessSearch::playMove(chessMove move, moveUndo* undo){
+    logic.makeMove(move, undo);
+    pawnKey ^= getPawnKeyChange(*undo);
+    sideToMove = (sideToMove == WHITE) ? BLACK : WHITE;
+    positions.push(chessHash::hashBoard(&board, sideToMove, &rights), rights.halfmoveClock);
+}
+
+uint64_t chessSearch::getPawnKeyChange(const moveUndo& undo){
+    uint64_t change = 0;
+    chessTile movedTile = undo.movedPiece, capturedTile = undo.capturedPiece;
+    pieceData moved = movedTile.getActivePiece();
+    if(moved.pieceType == PAWN){
+        change ^= chessHash::getPieceKey(PAWN, moved.pieceColor, undo.move.from);
+        if(board[undo.move.to.posX][undo.move.to.posY].getActivePiece().pieceType == PAWN){
+            change ^= chessHash::getPieceKey(PAWN, moved.pieceColor, undo.move.to);
+        }
+    }
+    pieceData captured = capturedTile.getActivePiece();
+    if(captured.pieceType == PAWN){
+        change ^= chessHash::getPieceKey(PAWN, captured.pieceColor, undo.capturedAt);
+    }
+    return change;
+}
+
+void chessSearch::unplayMove(const moveUndo& undo){
+    pawnKey ^= getPawnKeyChange(undo);
+    positions.pop();
+    sideToMove = (sideToMove == WHITE) ? BLACK : WHITE;
+    logic.unmakeMove(undo);
+}
+
+bool chessSearch::isOutOfBudget(){
+    if(isAborted){
+        return true;
+    }
+    // the node limit is exact, stop(), pondering and the clock are only polled every 1024 nodes
+    if((nodes & 1023) == 0){
+        isAborted = stopRequested.load(memory_order_relaxed);
+        isLimited = !isPondering.load(memory_order_acquire);
+        isAborted = isAborted || (isLimited && timeManager != NULL && timeManager->isPastHardLimit());
+    }
+    if(isLimited){
+        isAborted = isAborted || (nodeLimit != 0 && nodes >= nodeLimit) || (depthLimit != 0 && iterationDepth > depthLimit);
+    }
+    return isAborted;
+}
@@ -0,0 +1,279 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessSearch.h
+ *      Purpose: A small chess engine for computer players.  Searches a private copy of a position with iterative
+ *               deepening alpha-beta and a capture-only quiescence search, scoring positions by material and
+ *               piece placement.  Moves are generated and played by chessLogic, so the engine follows exactly
+ *               the same rules as the game.  A transposition table carries results between iterations and
+ *               searches, and in multi-PV analysis several best root moves get exact scores in the same
+ *               iterations.  Each instance belongs to one thread.
+ *      Input: A position from chessGame::setupSearch() and the limits of each search.
+ *      Output: The best move found, with its score.
+ *      Exceptions: None.
+ *
+ */
+
+#ifndef CHESSSEARCH_H
+#define CHESSSEARCH_H
+#include <cstdlib>
+#include <cstdint>
+#include <atomic>
+#include <functional>
+#include <vector>
+#include "globals.h"
+#include "chessTile.h"
+#include "chessLogic.h"
+#include "chessHistory.h"
+#include "chessArena.h"
+#include "chessMovePicker.h"
+#include "chessTransposition.h"
+#include "chessPawnTable.h"
+#include "chessTimeManager.h"
+
+using namespace std;
+
+    struct searchLimits {int depth; uint64_t nodes;};
+    // How far a search may go: the deepest iteration in plies and the number of nodes. 0 means no limit, but
+    // at least one of the two must be set unless the search has a time manager.
+    struct searchResult {chessMove bestMove; int score; int depth; uint64_t nodes; chessMove ponderMove;};
+    // Outcome of a search: the move to play, its score in centipawns for the side to move, the last completed
+    // iteration, the nodes visited and the reply expected to the move.  bestMove.from is -1,-1 if the side to
+    // move has no legal move, ponderMove.from if no reply is known.
+    struct searchLine {int score; vector<chessMove> moves;};
+    // One principal variation: its score in centipawns for the side to move and its moves from the root.
+
+class chessSearch {
+public:
+    static const int mateScore = 30000;
+    // Score of giving mate at the root. Mates further away score one less per ply.
+    
+    chessSearch();
+    // Purpose: Default constructor. Starts with an empty board until setPosition() is called.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessTournament;
+    //
+    void setPosition(chessTile (*ptr)[8][8], color, boardRights, const chessHistory&);
+    // Purpose: Copies the position to search, along with the game's earlier positions for repetition draws.
+    // Input:   chessTile (*ptr)[8][8] - The board to copy.
+    //          color sideToMove - The player to find a move for.
+    //          boardRights rights - Castling rights, en passant square and halfmove clock of the position.
+    //          const chessHistory& history - Positions of the game so far, ending with this one.
+    // Output:  None.
+    // Caller:  chessGame::setupSearch();
+    //
+    uint64_t playRootMove(chessMove);
+    // Purpose: Plays a legal move on the position to search, which then becomes the position after it.
+    // Input:   chessMove move - The move.
+    // Output:  uint64_t hash - Hash of the new position, as chessGame::getPositionHash() would give it.
+    // Caller:  chessEngine::startPondering();
+    //
+    searchResult search(searchLimits);
+    // Purpose: Finds the best move of the position by searching one ply deeper at a time until a limit is hit
+    //          or stop() is called.  Only completed iterations are trusted, but depth 1 always completes.
+    // Input:   searchLimits limits - Depth and node limits of the search.
+    // Output:  searchResult result - Best move, score, depth and nodes.
+    // Caller:  chessTournament::playGame(); chessEngine::searchLoop();
+    //
+    void setPondering(bool);
+    // Purpose: Turns pondering on before a search, or off while it runs.  A pondering search ignores its
+    //          limits and deepens until stop() is called; once pondering is turned off the limits apply again,
+    //          counting what was already searched.  Safe to call from another thread.
+    // Input:   bool isOn - TRUE to ponder.
+    // Output:  None.
+    // Caller:  chessEngine;
+    //
+    void setTimeManager(chessTimeManager*);
+    // Purpose: Lets a time manager decide how long searches may take, on top of their limits.  It is told
+    //          about every completed iteration and asked before the next one, and its hard limit is polled
+    //          along with stop().  Like the limits it is ignored while pondering.
+    // Input:   chessTimeManager* manager - The manager, started before each search or ponder hit; NULL for none.
+    // Output:  None.
+    // Caller:  chessEngine;
+    //
+    void setLineCount(int);
+    // Purpose: Sets how many of the best root moves each search scores exactly, each with its principal
+    //          variation.  More lines narrow the pruning at the root only, so K lines cost far less than K
+    //          searches.
+    // Input:   int count - Number of lines, 1 by default.
+    // Output:  None.
+    // Caller:  main();
+    //
+    void getLines(vector<searchLine>*);
+    // Purpose: Returns the lines of the last completed iteration, best first.  Fewer than asked for if the
+    //          position has fewer legal moves.
+    // Input:   vector<searchLine>* lines - Receives the lines, replacing its contents.
+    // Output:  None.
+    // Caller:  main();
+    //
+    void clearTable();
+    // Purpose: Empties the transposition and pawn tables, so a new game is played without results from the last one.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessTournament::playGame();
+    //
+    void setReporter(function<void(const searchResult&)>);
+    // Purpose: Sets a function to call with the result of every completed iteration, so a long search can be
+    //          followed while it runs.  It is called on the searching thread.
+    // Input:   function<void(const searchResult&)> report - The function, or an empty function for none.
+    // Output:  None.
+    // Caller:  chessHint::chessHint();
+    //
+    void stop();
+    // Purpose: Asks a running search to return as soon as possible. Safe to call from another thread.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessHint; chessEngine;
+    //
+    int evaluate();
+    // Purpose: Scores the position statically by material, piece-square bonuses and pawn structure: passed,
+    //          isolated, doubled and backward pawns and the pawns sheltering a king on its first two ranks.  The
+    //          pawn terms are looked up in pawnTable and only worked out for pawns not seen before.
+    // Input:   None.
+    // Output:  int score - Centipawns, positive if the side to move is better.
+    // Caller:  chessSearch::quiescence();
+    //
+    bool isInsufficientMaterial();
+    // Purpose: Checks whether neither side has enough material left to give mate: bare kings, or a single
+    //          knight or bishop against a bare king.
+    // Input:   None.
+    // Output:  Returns TRUE if the position is a dead draw.
+    // Caller:  chessTournament::playGame();
+    //
+    
+private:
+    int alphaBeta(int, int, int, int);
+    // Purpose: Negamax alpha-beta search of the position to a fixed depth.
+    // Input:   int depth - Remaining plies, quiescence search takes over at 0.
+    //          int ply - Distance from the root.
+    //          int alpha, beta - Search window for the side to move.
+    // Output:  int score - Score of the position for the side to move.
+    // Caller:  chessSearch::search(); chessSearch::alphaBeta();
+    //
+    int quiescence(int, int, int);
+    // Purpose: Searches captures only until the position is quiet, so the static score is never taken in the
+    //          middle of an exchange.
+    // Input:   int ply - Distance from the root.
+    //          int alpha, beta - Search window for the side to move.
+    // Output:  int score - Score of the position for the side to move.
+    // Caller:  chessSearch::alphaBeta(); chessSearch::quiescence();
+    //
+    int recordRootLine(chessMove, int);
+    // Purpose: Adds a root move whose score is exact to the best lines of the iteration in progress.
+    // Input:   chessMove move - The root move.
+    //          int score - Its score.
+    // Output:  int alpha - The score a root move has to beat to be among the best lines from now on.
+    // Caller:  chessSearch::alphaBeta();
+    //
+    void readLine(chessMove, int, vector<chessMove>*);
+    // Purpose: Follows the best moves stored in the transposition table from a root move, as long as they
+    //          are legal and do not repeat a position.
+    // Input:   chessMove move - The root move.
+    //          int length - The most moves to read.
+    //          vector<chessMove>* line - Receives the root move and the moves after it.
+    // Output:  None.
+    // Caller:  chessSearch::search();
+    //
+    void recordCutoff(chessMove, int, int);
+    // Purpose: Remembers a quiet move that caused a beta cutoff as a killer of its ply, and raises its history score.
+    // Input:   chessMove move - The move.
+    //          int depth - Remaining plies of the node it was played in.
+    //          int ply - Distance of that node from the root.
+    // Output:  None.
+    // Caller:  chessSearch::alphaBeta();
+    //
+    void playMove(chessMove, moveUndo*);
+    // Purpose: Makes a move on the search board and passes the turn.
+    // Input:   chessMove move - The move to play.
+    //          moveUndo* undo - Receives what unplayMove() needs to take it back.
+    // Output:  None.
+    // Caller:  chessSearch::alphaBeta(); chessSearch::quiescence();
+    //
+    uint64_t getPawnKeyChange(const moveUndo&);
+    // Purpose: Works out how a move changes the pawn hash: a pawn leaving its square, arriving unless it
+    //          promotes, or being captured.
+    // Input:   const moveUndo& undo - Record of the move, with the board as it is after the move.
+    // Output:  uint64_t change - Keys to XOR into pawnKey, 0 if no pawn is involved.
+    // Caller:  chessSearch::playMove(); chessSearch::unplayMove();
+    //
+    void unplayMove(const moveUndo&);
+    // Purpose: Takes back a move made by playMove() and passes the turn back.
+    // Input:   const moveUndo& undo - Record of the move.
+    // Output:  None.
+    // Caller:  chessSearch::alphaBeta(); chessSearch::quiescence();
+    //
+    bool isOutOfBudget();
+    // Purpose: Checks whether the search has to stop because of stop(), the node limit, an iteration deeper
+    //          than the depth limit or the time manager's hard limit once pondering is over.
+    // Input:   None.
+    // Output:  Returns TRUE once the search is aborted.
+    // Caller:  chessSearch::alphaBeta(); chessSearch::quiescence();
+    //
+    
+    chessTile board[8][8] = {};
+    // The search's own copy of the position.
+    color sideToMove = WHITE;
+    // Player to move in the searched position.
+    color inCheck = NONE;
+    // Check flag required by chessLogic.
+    boardRights rights = {0, {-1, -1}, 0};
+    // Castling rights, en passant square and halfmove clock of the searched position.
+    chessLogic logic;
+    // Rules of the game, working on board.
+    chessHistory positions;
+    // Positions of the game and the current search line, for repetition draws.
+    vector<chessMove> rootMoves;
+    // Legal moves of the searched position, reused between searches.
+    static const int maxPly = 128;
+    // Deepest ply searched, quiescence included.
+    vector<chessMovePicker> pickers;
+    // Move picker of each ply, reused between nodes. Sized once, so references into it stay valid.
+    chessMove killers[maxPly][2];
+    // The last two quiet moves of each ply that caused a beta cutoff.
+    int history[2][64][64];
+    // Score of each quiet move of each color by from and to square, raised whenever the move causes a cutoff.
+    chessMove rootBest = {{-1, -1}, {-1, -1}, NOPIECE};
+    // Best move at the root of the iteration in progress.
+    chessMove rootReply = {{-1, -1}, {-1, -1}, NOPIECE};
+    // Best reply to rootBest found by the iteration in progress.
+    chessMove lineReply = {{-1, -1}, {-1, -1}, NOPIECE};
+    // Best reply found so far to the root move being searched.
+    uint64_t nodes = 0, nodeLimit = 0;
+    // Nodes visited by the current search, and its node budget, 0 for none.
+    int iterationDepth = 0, depthLimit = 0;
+    // Depth of the iteration in progress, and the deepest iteration allowed, 0 for no limit.
+    bool isLimited = true;
+    // Cleared while pondering, when the limits do not apply. Refreshed whenever stop() is polled.
+    bool isAborted = false;
+    // Set once the current iteration ran out of budget, its results are then discarded.
+    chessArena arena;
+    // Scratch memory of the current search, reset when it ends.
+    atomic<bool> stopRequested;
+    // Set by stop().
+    atomic<bool> isPondering;
+    // Set by setPondering(). Turning it off publishes the time manager's limits to the search thread.
+    chessTimeManager* timeManager = NULL;
+    // Set by setTimeManager(), NULL if searches are not timed.
+    chessTransposition table;
+    // Results of positions searched so far, kept between searches until clearTable().
+    uint64_t tableProbes = 0, tableHits = 0;
+    // Lookups in the table during the current search, and how many found the position.
+    chessPawnTable pawnTable;
+    // Pawn structure terms of the pawns evaluated so far, kept between searches until clearTable().
+    uint64_t pawnKey = 0;
+    // Hash of the pawns of the searched position, kept up to date by playMove() and unplayMove().
+    uint64_t pawnProbes = 0, pawnHits = 0;
+    // Lookups in pawnTable during the current search, and how many found the pawns.
+    int lineCount = 1;
+    // Number of root moves each search scores exactly.
+    vector<searchLine> rootLines;
+    // The best lines of the iteration in progress, best first, at most lineCount. Only their root moves and
+    // scores are filled in.
+    vector<searchLine> lines;
+    // The best lines of the last completed iteration, with their principal variations.
+    function<void(const searchResult&)> reporter;
+    // Called with the result of each completed iteration, if set.
+};
+
+#endif /* CHESSSEARCH_H */
@@ -0,0 +1,126 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessStats.cpp
+ *      Purpose: Engine wide performance counters, counted per thread and aggregated on demand.
+ *      Input: None.
+ *      Output: JSON object with the aggregated counters.
+ *      Exceptions: None.
+ *
+ */
+
+#include "chessStats.h"
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+    struct statBlock;
+
+    // every live thread's counter block, plus the totals of threads that have already finished
+    struct statRegistry {
+        mutex lock;
+        vector<statBlock*> blocks;
+        uint64_t retired[STAT_COUNTER_TOTAL] = {};
+    };
+
+    statRegistry& getRegistry(){
+        static statRegistry registry;
+        return registry;
+    }
+
+    // counters owned by one thread. Only the owner writes them, so relaxed loads and stores are enough and
+    // counting never waits on another thread; the atomics only make concurrent snapshots well defined.
+    struct statBlock {
+        atomic<uint64_t> counts[STAT_COUNTER_TOTAL];
+
+        statBlock(){
+            for(int i = 0; i < STAT_COUNTER_TOTAL; i++){
+                counts[i].store(0, memory_order_relaxed);
+            }
+            statRegistry& registry = getRegistry();
+            lock_guard<mutex> guard(registry.lock);
+            registry.blocks.push_back(this);
+        }
+
+        // fold the thread's counts into the retired totals when it exits
+        ~statBlock(){
+            statRegistry& registry = getRegistry();
+            lock_guard<mutex> guard(registry.lock);
+            for(int i = 0; i < STAT_COUNTER_TOTAL; i++){
+                registry.retired[i] += counts[i].load(memory_order_relaxed);
+            }
+            for(size_t i = 0; i < registry.blocks.size(); i++){
+                if(registry.blocks[i] == this){
+                    registry.blocks.erase(registry.blocks.begin() + i);
+                    break;
+                }
+            }
+        }
+    };
+
+    thread_local statBlock localStats;
+}
+
+void chessStats::increment(statCounter counter, uint64_t amount){
+    atomic<uint64_t>& count = localStats.counts[counter];
+    count.store(count.load(memory_order_relaxed) + amount, memory_order_relaxed);
+}
+
+void chessStats::countMoveGeneration(chessPieceType p){
+    if(p < NOPIECE){
+        increment(statCounter(MOVEGEN_PAWN + p));
+    }
+}
+
+void chessStats::snapshot(uint64_t* totals){
+    statRegistry& registry = getRegistry();
+    lock_guard<mutex> guard(registry.lock);
+    for(int i = 0; i < STAT_COUNTER_TOTAL; i++){
+        totals[i] = registry.retired[i];
+    }
+    for(size_t b = 0; b < registry.blocks.size(); b++){
+        for(int i = 0; i < STAT_COUNTER_TOTAL; i++){
+            totals[i] += registry.blocks[b]->counts[i].load(memory_order_relaxed);
+        }
+    }
+}
+
+string chessStats::toJson(){
+    uint64_t t[STAT_COUNTER_TOTAL];
+    snapshot(t);
+
+    double hitRate = (t[CACHE_PROBES] > 0) ? double(t[CACHE_HITS]) / double(t[CACHE_PROBES]) : 0.0;
+    double pawnHitRate = (t[PAWN_PROBES] > 0) ? double(t[PAWN_HITS]) / double(t[PAWN_PROBES]) : 0.0;
+    char buffer[768];
+    snprintf(buffer, sizeof(buffer),
+        "{\"moveGeneration\":{\"pawn\":%llu,\"rook\":%llu,\"knight\":%llu,\"bishop\":%llu,\"queen\":%llu,\"king\":%llu},"
+        "\"checkTests\":%llu,\"checkSimulations\":%llu,\"boardCopies\":%llu,\"nodesSearched\":%llu,"
+        "\"cache\":{\"probes\":%llu,\"hits\":%llu,\"hitRate\":%.4f},"
+        "\"pawnCache\":{\"probes\":%llu,\"hits\":%llu,\"hitRate\":%.4f},"
+        "\"ponder\":{\"hits\":%llu,\"misses\":%llu}}",
+        (unsigned long long)t[MOVEGEN_PAWN], (unsigned long long)t[MOVEGEN_ROOK],
+        (unsigned long long)t[MOVEGEN_KNIGHT], (unsigned long long)t[MOVEGEN_BISHOP],
+        (unsigned long long)t[MOVEGEN_QUEEN], (unsigned long long)t[MOVEGEN_KING],
+        (unsigned long long)t[CHECK_TESTS], (unsigned long long)t[CHECK_SIMULATIONS],
+        (unsigned long long)t[BOARD_COPIES], (unsigned long long)t[NODES_SEARCHED],
+        (unsigned long long)t[CACHE_PROBES], (unsigned long long)t[CACHE_HITS], hitRate,
+        (unsigned long long)t[PAWN_PROBES], (unsigned long long)t[PAWN_HITS], pawnHitRate,
+        (unsigned long long)t[PONDER_HITS], (unsigned long long)t[PONDER_MISSES]);
+    return buffer;
+}
+
+void chessStats::reset(){
+    statRegistry& registry = getRegistry();
+    lock_guard<mutex> guard(registry.lock);
+    for(int i = 0; i < STAT_COUNTER_TOTAL; i++){
+        registry.retired[i] = 0;
+    }
+    for(size_t b = 0; b < registry.blocks.size(); b++){
+        for(int i = 0; i < STAT_COUNTER_TOTAL; i++){
+            registry.blocks[b]->counts[i].store(0, memory_order_relaxed);
+        }
+    }
+}
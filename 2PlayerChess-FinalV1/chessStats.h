@@ -0,0 +1,66 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessStats.h
+ *      Purpose: Engine wide performance counters.  Every thread counts into its own block of counters, so counting
+ *               costs a single uncontended store; the blocks are only summed when a snapshot or stats dump is
+ *               requested.  Counters of threads that have finished are kept, so a dump after a parallel build
+ *               still covers all of its workers.
+ *      Input: None.
+ *      Output: JSON object with the aggregated counters, see toJson().
+ *      Exceptions: None.
+ *
+ */
+
+#ifndef CHESSSTATS_H
+#define CHESSSTATS_H
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+#include "globals.h"
+
+using namespace std;
+
+    enum statCounter{MOVEGEN_PAWN, MOVEGEN_ROOK, MOVEGEN_KNIGHT, MOVEGEN_BISHOP, MOVEGEN_QUEEN, MOVEGEN_KING,
+                     CHECK_TESTS, CHECK_SIMULATIONS, BOARD_COPIES, NODES_SEARCHED, CACHE_PROBES, CACHE_HITS,
+                     PAWN_PROBES, PAWN_HITS, PONDER_HITS, PONDER_MISSES, STAT_COUNTER_TOTAL};
+    // The events that are counted. The MOVEGEN_ entries follow the order of chessPieceType. BOARD_COPIES counts
+    // squares copied out of the board to inspect or simulate a position. PAWN_ entries count lookups in the pawn
+    // structure cache of the evaluation.
+
+class chessStats {
+public:
+    static void increment(statCounter, uint64_t = 1);
+    // Purpose: Adds to one of the calling thread's counters.
+    // Input:   statCounter counter - The counter to add to.
+    //          uint64_t amount - The amount to add, 1 by default.
+    // Output:  None.
+    // Caller:  chessLogic; chessNotation::writeMove(); chessSearch::search(); chessEngine::chooseMove();
+    //
+    static void countMoveGeneration(chessPieceType);
+    // Purpose: Counts one call of the move generator for a piece type. NOPIECE is ignored.
+    // Input:   chessPieceType p - The type of piece whose moves are generated.
+    // Output:  None.
+    // Caller:  chessLogic::isValidPieceMove(); chessLogic::queryAllMovesByColor(); chessLogic::isPlayerOutOfMoves();
+    //
+    static void snapshot(uint64_t*);
+    // Purpose: Sums the counters of every live and finished thread.
+    // Input:   uint64_t* totals - Array of STAT_COUNTER_TOTAL entries that receives the sums.
+    // Output:  None.
+    // Caller:  chessStats::toJson();
+    //
+    static string toJson();
+    // Purpose: Aggregates all counters and formats them as a single line JSON object.
+    // Input:   None.
+    // Output:  string json - The counters, grouped by move generation, checks, search, caching and pondering.
+    // Caller:  chessGame::handleInput(); chessGame::endGame(); main();
+    //
+    static void reset();
+    // Purpose: Sets the counters of every thread back to zero and forgets finished threads.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessGame::startNewGame();
+    //
+};
+
+#endif /* CHESSSTATS_H */
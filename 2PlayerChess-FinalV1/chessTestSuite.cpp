@@ -0,0 +1,244 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessTestSuite.cpp
+ *      Purpose: Parallel EPD test suite runner reporting the solve rate and time and nodes to solution.
+ *      Input: None.
+ *      Output: One line per position and a summary on standard output.
+ *      Exceptions: None.
+ *
+ */
+
+#include "chessTestSuite.h"
+#include "chessThreadPool.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+    // splits the next blank separated word off the front of text
+    string_view nextWord(string_view* text){
+        size_t start = text->find_first_not_of(" \t\r");
+        if(start == string_view::npos){
+            text->remove_prefix(text->size());
+            return string_view();
+        }
+        size_t end = text->find_first_of(" \t\r", start);
+        string_view word = text->substr(start, (end == string_view::npos) ? string_view::npos : end - start);
+        text->remove_prefix((end == string_view::npos) ? text->size() : end);
+        return word;
+    }
+}
+
+chessTestSuite::chessTestSuite() : nextPosition(0) {
+    threadCount = chessThreadPool::getShared().getConcurrency();
+    limits = {0, 200000};
+    moveTime = 0;
+}
+
+void chessTestSuite::setThreadCount(int count){
+    threadCount = (count < 1) ? 1 : count;
+}
+
+void chessTestSuite::setBudget(searchLimits searchLimit, int milliseconds){
+    limits = searchLimit;
+    moveTime = (milliseconds > 0) ? milliseconds : 0;
+}
+
+bool chessTestSuite::loadSuite(string path){
+    ifstream file(path);
+    string line;
+    chessGame game;
+    int lineNumber = 0;
+    if(!file.is_open()){
+        return false;
+    }
+    positions.clear();
+    while(getline(file, line)){
+        lineNumber++;
+        // blank lines and '#' comments are skipped, as in game archives
+        if(line.empty() || line[0] == '#' || line[0] == '\r'){
+            continue;
+        }
+
+        // the four position fields of FEN, then operations ended by ';'
+        testPosition position;
+        string_view rest = line;
+        for(int f = 0; f < 4; f++){
+            position.fen += (f == 0) ? "" : " ";
+            position.fen += nextWord(&rest);
+        }
+        if(!game.loadPosition(position.fen) || game.isGameOver()){
+            cout << "Skipping line " << lineNumber << ": not a position with a move to find" << endl;
+            continue;
+        }
+        position.id = "line " + to_string(lineNumber);
+
+        bool isValid = true;
+        while(isValid && rest.find_first_not_of(" \t\r") != string_view::npos){
+            size_t end = rest.find(';');
+            string_view operation = rest.substr(0, end);
+            rest.remove_prefix((end == string_view::npos) ? rest.size() : end + 1);
+            string_view opcode = nextWord(&operation);
+            if(opcode == "id"){
+                size_t first = operation.find('"'), last = operation.rfind('"');
+                position.id = (first != last) ? string(operation.substr(first + 1, last - first - 1)) : string(nextWord(&operation));
+            }
+            else if(opcode == "bm" || opcode == "am"){
+                vector<chessMove>& moves = (opcode == "bm") ? position.bestMoves : position.avoidMoves;
+                position.moveText += (position.moveText.empty() ? "" : ", ") + string(opcode);
+                for(string_view word = nextWord(&operation); !word.empty(); word = nextWord(&operation)){
+                    chessMove move;
+                    isValid = isValid && game.readMove(word, &move);
+                    moves.push_back(move);
+                    position.moveText += " " + string(word);
+                }
+            }
+        }
+        if(!isValid || (position.bestMoves.empty() && position.avoidMoves.empty())){
+            cout << "Skipping line " << lineNumber << ": no bm or am operation with legal moves" << endl;
+            continue;
+        }
+        positions.push_back(position);
+    }
+    return !positions.empty();
+}
+
+int chessTestSuite::run(){
+    nextPosition = 0;
+    results.assign(positions.size(), testResult{{{-1, -1}, {-1, -1}, NOPIECE}, 0, false, 0, 0, 0});
+
+    cout << positions.size() << " positions, ";
+    if(moveTime > 0){
+        cout << moveTime << " ms";
+    }
+    if(limits.nodes != 0){
+        cout << ((moveTime > 0) ? ", " : "") << limits.nodes << " nodes";
+    }
+    if(limits.depth != 0){
+        cout << ((moveTime > 0 || limits.nodes != 0) ? ", " : "") << "depth " << limits.depth;
+    }
+    cout << " each, " << threadCount << " at a time" << endl;
+
+    // each worker task solves positions one after another on the shared pool
+    auto start = chrono::steady_clock::now();
+    chessThreadPool& pool = chessThreadPool::getShared();
+    chessTaskGroup workers;
+    for(int i = 0; i < threadCount; i++){
+        pool.submit(&workers, [this](){ testWorker(); });
+    }
+    pool.wait(&workers);
+    auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+
+    printReport(elapsed.count());
+    int solved = 0;
+    for(int i = 0; i < results.size(); i++){
+        solved += results[i].isSolved;
+    }
+    return solved;
+}
+
+void chessTestSuite::testWorker(){
+    chessGame game;
+    chessSearch search;
+    chessTimeManager timer;
+
+    for(;;){
+        int index = nextPosition.fetch_add(1);
+        if(index >= int(positions.size())){
+            return;
+        }
+        results[index] = solvePosition(&game, &search, &timer, positions[index]);
+    }
+}
+
+chessTestSuite::testResult chessTestSuite::solvePosition(chessGame* game, chessSearch* search, chessTimeManager* timer, const testPosition& position){
+    testResult result = {{{-1, -1}, {-1, -1}, NOPIECE}, 0, false, 0, 0, 0};
+    auto start = chrono::steady_clock::now();
+
+    // a position must not profit from the table of the one searched before it on this thread
+    game->loadPosition(position.fen);
+    game->setupSearch(search);
+    search->clearTable();
+
+    // the solution counts from the first iteration of the unbroken run of correct ones that ends the search
+    search->setReporter([&](const searchResult& iteration){
+        if(!isCorrect(position, iteration.bestMove)){
+            result.isSolved = false;
+        }
+        else if(!result.isSolved){
+            result.isSolved = true;
+            result.solveTime = int(chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count());
+            result.solveNodes = iteration.nodes;
+        }
+    });
+    search->setTimeManager((moveTime > 0) ? timer : NULL);
+    if(moveTime > 0){
+        timer->startFixed(moveTime);
+    }
+    searchResult found = search->search(limits);
+    search->setReporter(nullptr);
+
+    result.found = found.bestMove;
+    result.depth = found.depth;
+    result.nodes = found.nodes;
+    result.isSolved = result.isSolved && isCorrect(position, found.bestMove);
+    return result;
+}
+
+bool chessTestSuite::isCorrect(const testPosition& position, chessMove move){
+    auto isSame = [&move](const chessMove& other){
+        return move.from.posX == other.from.posX && move.from.posY == other.from.posY && move.to.posX == other.to.posX
+               && move.to.posY == other.to.posY && move.promotion == other.promotion;
+    };
+    for(int i = 0; i < position.avoidMoves.size(); i++){
+        if(isSame(position.avoidMoves[i])){
+            return false;
+        }
+    }
+    if(position.bestMoves.empty()){
+        return true;
+    }
+    for(int i = 0; i < position.bestMoves.size(); i++){
+        if(isSame(position.bestMoves[i])){
+            return true;
+        }
+    }
+    return false;
+}
+
+void chessTestSuite::printReport(long long elapsed){
+    chessGame game;
+    int solved = 0;
+    long long solveTime = 0;
+    uint64_t solveNodes = 0, nodes = 0;
+
+    for(int i = 0; i < positions.size(); i++){
+        const testResult& result = results[i];
+        char san[12] = "none";
+        game.loadPosition(positions[i].fen);
+        if(result.found.from.posX >= 0){
+            game.writeMove(result.found, san);
+        }
+        cout << (result.isSolved ? "  solved  " : "  missed  ") << positions[i].id << "  " << positions[i].moveText
+             << "  found " << san << " at depth " << result.depth;
+        if(result.isSolved){
+            cout << " after " << result.solveTime << " ms, " << result.solveNodes << " nodes";
+            solved++;
+            solveTime += result.solveTime;
+            solveNodes += result.solveNodes;
+        }
+        cout << endl;
+        nodes += result.nodes;
+    }
+
+    char rate[16];
+    snprintf(rate, sizeof(rate), "%.1f%%", positions.empty() ? 0.0 : 100.0 * solved / positions.size());
+    cout << "Solved " << solved << " of " << positions.size() << " (" << rate << ") in " << elapsed << " ms, "
+         << nodes << " nodes searched" << endl;
+    if(solved > 0){
+        cout << "Mean to solution: " << solveTime / solved << " ms, " << solveNodes / solved << " nodes" << endl;
+    }
+}
@@ -0,0 +1,122 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessTestSuite.h
+ *      Purpose: Runs a test suite of positions in Extended Position Description (EPD) format, each with the best
+ *               moves ("bm") or moves to avoid ("am") it is judged by, to measure the engine's tactical strength.
+ *               Positions are searched under the same node or time budget by worker tasks on the shared
+ *               chessThreadPool.  A position counts as solved if the move found at the end of the budget is
+ *               correct, and its time and nodes to solution are those of the iteration from which on the
+ *               best move stayed correct.
+ *      Input: An EPD file, one position per line: the four position fields of FEN followed by operations such
+ *             as 'bm Nf3 Qxd5;', 'am Bxh7;' and 'id "WAC.001";'.
+ *      Output: One line per position and a summary with the solve rate on standard output.
+ *      Exceptions: A file that cannot be read is reported through the return value of loadSuite(); unusable
+ *                  lines are skipped with a message.
+ *
+ */
+
+#ifndef CHESSTESTSUITE_H
+#define CHESSTESTSUITE_H
+#include <cstdlib>
+#include <cstdint>
+#include <atomic>
+#include <string>
+#include <vector>
+#include "globals.h"
+#include "chessGame.h"
+#include "chessSearch.h"
+#include "chessTimeManager.h"
+
+using namespace std;
+
+class chessTestSuite {
+public:
+    chessTestSuite();
+    // Purpose: Default constructor. Uses every available core and 200000 nodes a position.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  main();
+    //
+    void setThreadCount(int);
+    // Purpose: Sets the number of positions searched at the same time, at most as many as the shared
+    //          chessThreadPool has threads.
+    // Input:   int count - Number of worker tasks, at least 1.
+    // Output:  None.
+    // Caller:  main();
+    //
+    void setBudget(searchLimits, int);
+    // Purpose: Sets how long each position is searched.
+    // Input:   searchLimits limits - Depth and node limits of each search.
+    //          int moveTime - Milliseconds for each search, 0 for none.  Times depend on the machine and its
+    //          load, so node budgets are better for comparing builds.
+    // Output:  None.
+    // Caller:  main();
+    //
+    bool loadSuite(string);
+    // Purpose: Reads the positions of an EPD file.  Lines without a "bm" or "am" operation, with an invalid
+    //          position or with a move that is not legal in it are skipped with a message.
+    // Input:   string path - The EPD file.
+    // Output:  Returns FALSE if the file could not be read or held no usable positions.
+    // Caller:  main();
+    //
+    int run();
+    // Purpose: Searches every position and prints the results.
+    // Input:   None.
+    // Output:  int solved - Number of positions solved.
+    // Caller:  main();
+    //
+
+private:
+    struct testPosition {string fen; string id; vector<chessMove> bestMoves; vector<chessMove> avoidMoves; string moveText;};
+    // One position of the suite: its four FEN fields, its id or line number, the moves judging it, and its
+    // operations as written for the report, e.g. "bm Nf3".
+    struct testResult {chessMove found; int depth; bool isSolved; int solveTime; uint64_t solveNodes; uint64_t nodes;};
+    // Outcome of searching a position: the move found, the depth reached, and if solved, the milliseconds and
+    // nodes the search took until its best move was correct for good.
+
+    void testWorker();
+    // Purpose: Worker task. Takes positions and solves them until none are left.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessTestSuite::run();
+    //
+    testResult solvePosition(chessGame*, chessSearch*, chessTimeManager*, const testPosition&);
+    // Purpose: Searches one position under the budget, watching every iteration for the solution.
+    // Input:   chessGame* game - Headless game instance owned by the calling worker.
+    //          chessSearch* search - Search owned by the calling worker.
+    //          chessTimeManager* timer - Timer of the search when there is a move time.
+    //          const testPosition& position - The position.
+    // Output:  testResult result - How the search did.
+    // Caller:  chessTestSuite::testWorker();
+    //
+    static bool isCorrect(const testPosition&, chessMove);
+    // Purpose: Checks a move against a position's operations: it has to be one of the best moves if there are
+    //          any, and none of the moves to avoid.
+    // Input:   const testPosition& position - The position.
+    //          chessMove move - The move found.
+    // Output:  Returns TRUE if the move solves the position.
+    // Caller:  chessTestSuite::solvePosition();
+    //
+    void printReport(long long);
+    // Purpose: Prints one line per position, then the solve rate and the mean time and nodes to solution.
+    // Input:   long long elapsed - Milliseconds the whole suite took.
+    // Output:  None.
+    // Caller:  chessTestSuite::run();
+    //
+
+    int threadCount;
+    // Number of positions searched at the same time.
+    searchLimits limits;
+    // Depth and node limits of each search.
+    int moveTime;
+    // Milliseconds for each search, 0 for none.
+    vector<testPosition> positions;
+    // The positions of the suite.
+    vector<testResult> results;
+    // Outcome of each position, filled in by the workers, each position by one worker only.
+    atomic<int> nextPosition;
+    // Number of the next position to hand to a worker.
+};
+
+#endif /* CHESSTESTSUITE_H */
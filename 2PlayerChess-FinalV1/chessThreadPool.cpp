@@ -0,0 +1,145 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessThreadPool.cpp
+ *      Purpose: Work-stealing task scheduler with one task deque per worker thread.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ *
+ */
+
+#include "chessThreadPool.h"
+
+namespace {
+    thread_local chessThreadPool* currentPool = NULL;
+    thread_local int currentWorker = -1;
+    // the pool and deque index of a worker thread, so tasks it submits go to its own deque
+    thread_local uint64_t randomState = 0;
+}
+
+chessThreadPool::chessThreadPool(int threads){
+    threads = (threads < 1) ? 1 : threads;
+    for(int i = 0; i < threads; i++){
+        queues.push_back(unique_ptr<workerQueue>(new workerQueue()));
+    }
+    for(int i = 0; i < threads; i++){
+        workers.push_back(thread(&chessThreadPool::workerLoop, this, i));
+    }
+}
+
+chessThreadPool::~chessThreadPool(){
+    {
+        lock_guard<mutex> lock(sleepLock);
+        isStopping = true;
+    }
+    wakeUp.notify_all();
+    for(int i = 0; i < workers.size(); i++){
+        workers.at(i).join();
+    }
+}
+
+chessThreadPool& chessThreadPool::getShared(){
+    // never destroyed: workers may still be asleep while static objects they use are torn down at exit
+    static chessThreadPool* shared = new chessThreadPool((int)thread::hardware_concurrency() - 1);
+    return *shared;
+}
+
+int chessThreadPool::getConcurrency(){
+    return workers.size() + 1;
+}
+
+void chessThreadPool::submit(chessTaskGroup* group, function<void()> task){
+    group->pending.fetch_add(1);
+    int index = (currentPool == this) ? currentWorker : nextRandom() % queues.size();
+    {
+        lock_guard<mutex> lock(queues.at(index)->lock);
+        queues.at(index)->tasks.push_back({task, group});
+    }
+    {
+        lock_guard<mutex> lock(sleepLock);
+        queuedTasks.fetch_add(1);
+    }
+    wakeUp.notify_one();
+}
+
+void chessThreadPool::wait(chessTaskGroup* group){
+    int index = (currentPool == this) ? currentWorker : -1;
+    while(group->pending.load() > 0){
+        if(runOneTask(index)){
+            continue;
+        }
+        // nothing to run: sleep until a task is queued or a group finishes
+        unique_lock<mutex> lock(sleepLock);
+        wakeUp.wait(lock, [this, group](){ return group->pending.load() == 0 || queuedTasks.load() > 0; });
+    }
+}
+
+void chessThreadPool::workerLoop(int index){
+    currentPool = this;
+    currentWorker = index;
+    randomState = index + 1;
+    for(;;){
+        if(runOneTask(index)){
+            continue;
+        }
+        unique_lock<mutex> lock(sleepLock);
+        wakeUp.wait(lock, [this](){ return isStopping || queuedTasks.load() > 0; });
+        if(isStopping){
+            return;
+        }
+    }
+}
+
+bool chessThreadPool::runOneTask(int index){
+    queuedTask next;
+    bool isFound = false;
+    
+    // newest task of the own deque first, it is the most likely to still be in cache
+    if(index >= 0){
+        lock_guard<mutex> lock(queues.at(index)->lock);
+        if(!queues.at(index)->tasks.empty()){
+            next = queues.at(index)->tasks.back();
+            queues.at(index)->tasks.pop_back();
+            isFound = true;
+        }
+    }
+    // otherwise the oldest task of another deque, trying the victims from a random one onward
+    int count = queues.size();
+    int start = nextRandom() % count;
+    for(int i = 0; i < count && !isFound; i++){
+        int victim = (start + i) % count;
+        if(victim == index){
+            continue;
+        }
+        lock_guard<mutex> lock(queues.at(victim)->lock);
+        if(!queues.at(victim)->tasks.empty()){
+            next = queues.at(victim)->tasks.front();
+            queues.at(victim)->tasks.pop_front();
+            isFound = true;
+        }
+    }
+    if(!isFound){
+        return false;
+    }
+    
+    queuedTasks.fetch_sub(1);
+    next.task();
+    if(next.group->pending.fetch_sub(1) == 1){
+        // the last task of the group: wake its waiter
+        lock_guard<mutex> lock(sleepLock);
+        wakeUp.notify_all();
+    }
+    return true;
+}
+
+int chessThreadPool::nextRandom(){
+    // xorshift64, seeded per thread
+    if(randomState == 0){
+        randomState = hash<thread::id>()(this_thread::get_id()) | 1;
+    }
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 7;
+    randomState ^= randomState << 17;
+    return (int)(randomState >> 33);
+}
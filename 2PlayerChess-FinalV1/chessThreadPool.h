@@ -0,0 +1,118 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessThreadPool.h
+ *      Purpose: Work-stealing task scheduler shared by every parallel job of the program: index builds, self-play
+ *               matches and perft.  Each worker thread owns a task deque; it runs its own newest task first and,
+ *               when its deque is empty, steals the oldest task of a randomly chosen other worker.  One shared
+ *               pool sized to the machine replaces per-feature thread spawning, so jobs running side by side
+ *               never oversubscribe the cores.  A thread waiting for a group of tasks runs tasks itself instead
+ *               of blocking, so tasks may safely submit and wait for tasks of their own.
+ *      Input: Tasks submitted with submit().
+ *      Output: None.
+ *      Exceptions: None. Tasks must not throw.
+ *
+ */
+
+#ifndef CHESSTHREADPOOL_H
+#define CHESSTHREADPOOL_H
+#include <cstdlib>
+#include <cstdint>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+struct chessTaskGroup {
+    atomic<int> pending{0};
+};
+// A set of submitted tasks that can be waited for together. pending counts the tasks not yet finished.
+
+class chessThreadPool {
+public:
+    chessThreadPool(int);
+    // Purpose: Starts the worker threads.
+    // Input:   int threads - Number of worker threads, at least 1.
+    // Output:  None.
+    // Caller:  chessThreadPool::getShared();
+    //
+    ~chessThreadPool();
+    // Purpose: Stops and joins the worker threads. Tasks still queued are not run.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  None;
+    //
+    static chessThreadPool& getShared();
+    // Purpose: Returns the pool shared by the whole program, started on first use with one worker less than
+    //          the machine has cores, since the thread waiting for a job works on it too.
+    // Input:   None.
+    // Output:  chessThreadPool& pool - The shared pool.
+    // Caller:  chessIndex::buildIndex(); chessTournament::run(); chessGame::perft();
+    //
+    int getConcurrency();
+    // Purpose: Returns the number of threads that can run tasks at once: the workers and one waiting thread.
+    // Input:   None.
+    // Output:  int concurrency - Number of threads.
+    // Caller:  chessIndex::chessIndex(); chessTournament::chessTournament();
+    //
+    void submit(chessTaskGroup*, function<void()>);
+    // Purpose: Queues a task.  A worker queues it on its own deque, any other thread on a random worker's.
+    // Input:   chessTaskGroup* group - Group the task belongs to.
+    //          function<void()> task - The task.
+    // Output:  None.
+    // Caller:  chessIndex::buildIndex(); chessTournament::run(); chessGame::perft();
+    //
+    void wait(chessTaskGroup*);
+    // Purpose: Returns once every task of the group has finished, running queued tasks in the meantime.
+    // Input:   chessTaskGroup* group - The group to wait for.
+    // Output:  None.
+    // Caller:  chessIndex::buildIndex(); chessTournament::run(); chessGame::perft();
+    //
+    
+private:
+    struct queuedTask {function<void()> task; chessTaskGroup* group;};
+    // A task waiting to run, and the group to notify when it is done.
+    struct workerQueue {mutex lock; deque<queuedTask> tasks;};
+    // The task deque of one worker. The owner works at the back, thieves take from the front.
+    
+    void workerLoop(int);
+    // Purpose: Thread body. Runs tasks until the pool is destroyed, sleeping while there are none.
+    // Input:   int index - Index of the worker and of its deque.
+    // Output:  None.
+    // Caller:  chessThreadPool::chessThreadPool();
+    //
+    bool runOneTask(int);
+    // Purpose: Takes one task, from the own deque if there is one, otherwise stolen from the others starting
+    //          at a random victim, and runs it.
+    // Input:   int index - Index of the calling worker, -1 for a thread outside the pool.
+    // Output:  Returns FALSE if no task was found.
+    // Caller:  chessThreadPool::workerLoop(); chessThreadPool::wait();
+    //
+    int nextRandom();
+    // Purpose: Returns the next number of the calling thread's random generator, for choosing victims.
+    // Input:   None.
+    // Output:  int random - A non-negative random number.
+    // Caller:  chessThreadPool::submit(); chessThreadPool::runOneTask();
+    //
+    
+    vector<unique_ptr<workerQueue>> queues;
+    // One task deque per worker.
+    vector<thread> workers;
+    // The worker threads.
+    atomic<int> queuedTasks{0};
+    // Number of tasks in all deques, so idle threads can tell when to sleep.
+    mutex sleepLock;
+    // Guards sleeping on wakeUp.
+    condition_variable wakeUp;
+    // Signalled when a task is queued, a group finishes or the pool stops.
+    bool isStopping = false;
+    // Set by the destructor to end the worker loops.
+};
+
+#endif /* CHESSTHREADPOOL_H */
@@ -0,0 +1,91 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessTimeManager.cpp
+ *      Purpose: Per move time budgets for an engine playing on a clock.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ *
+ */
+
+#include "chessTimeManager.h"
+#include <algorithm>
+
+namespace {
+    const int moveOverhead = 50;
+    // Milliseconds kept back on every move for printing the board and reading the clock late.
+    const int movesToGo = 30;
+    // The time left is shared out as if this many moves remained.
+    const int hardFactor = 4;
+    // The hard limit is at most this many soft limits...
+    const int hardShare = 2;
+    // ...and never more than this part of the time left, so one bad move cannot lose on time.
+    const int stableIterationCount = 3;
+    // Iterations with the same best move after which the search is considered settled.
+    const int scoreDropMargin = 30;
+    // Centipawns an iteration must lose against the one before to count as the score dropping.
+}
+
+chessTimeManager::chessTimeManager() {
+}
+
+void chessTimeManager::start(int remaining, int increment){
+    startTime = chrono::steady_clock::now();
+    int available = max(remaining - moveOverhead, 1);
+    hardLimit = min((available / movesToGo + increment * 3 / 4) * hardFactor, available / hardShare);
+    softLimit = min(available / movesToGo + increment * 3 / 4, hardLimit);
+    isFixed = false;
+}
+
+void chessTimeManager::startFixed(int moveTime){
+    startTime = chrono::steady_clock::now();
+    softLimit = hardLimit = moveTime;
+    isFixed = true;
+}
+
+void chessTimeManager::newSearch(){
+    lastBest = {{-1, -1}, {-1, -1}, NOPIECE};
+    lastScore = 0;
+    stableIterations = 0;
+    isBestChanging = false;
+    isScoreDropping = false;
+}
+
+void chessTimeManager::recordIteration(chessMove bestMove, int score){
+    bool isFirst = lastBest.from.posX < 0;
+    bool isSame = !isFirst && bestMove.from.posX == lastBest.from.posX && bestMove.from.posY == lastBest.from.posY
+                  && bestMove.to.posX == lastBest.to.posX && bestMove.to.posY == lastBest.to.posY
+                  && bestMove.promotion == lastBest.promotion;
+    stableIterations = isSame ? stableIterations + 1 : 0;
+    isBestChanging = !isFirst && !isSame;
+    isScoreDropping = !isFirst && score <= lastScore - scoreDropMargin;
+    lastBest = bestMove;
+    lastScore = score;
+}
+
+bool chessTimeManager::isIterationAllowed(){
+    if(isFixed){
+        return getElapsed() < hardLimit;
+    }
+    int percent = 100;
+    if(stableIterations >= stableIterationCount){
+        percent = 60;
+    }
+    else if(isBestChanging){
+        percent = 140;
+    }
+    if(isScoreDropping){
+        percent += 50;
+    }
+    int target = min(int(int64_t(softLimit) * percent / 100), hardLimit);
+    return getElapsed() * 2 < target;
+}
+
+bool chessTimeManager::isPastHardLimit(){
+    return getElapsed() >= hardLimit;
+}
+
+int chessTimeManager::getElapsed(){
+    return int(chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - startTime).count());
+}
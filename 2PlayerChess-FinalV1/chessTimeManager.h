@@ -0,0 +1,101 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessTimeManager.h
+ *      Purpose: Decides how long the engine may think about a move when playing on a clock.  Each move gets a
+ *               soft limit, a share of the time left plus most of the increment, and a hard limit a few times
+ *               larger that is never allowed to come near the flag.  Between iterations the soft limit
+ *               shrinks while the best move stays the same and grows when the best move changes or the score
+ *               drops; the search never starts an iteration it is unlikely to finish in time.  The hard limit
+ *               is checked by chessSearch whenever it polls for stop(), every 1024 nodes.
+ *      Input: The time left and the increment, see start(), and the outcome of every iteration.
+ *      Output: Whether to search on, see isIterationAllowed() and isPastHardLimit().
+ *      Exceptions: None.
+ *
+ */
+
+#ifndef CHESSTIMEMANAGER_H
+#define CHESSTIMEMANAGER_H
+#include <cstdlib>
+#include <cstdint>
+#include <chrono>
+#include "globals.h"
+
+using namespace std;
+
+class chessTimeManager {
+public:
+    chessTimeManager();
+    // Purpose: Default constructor. The manager allows nothing until start() is called.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessEngine;
+    //
+    void start(int, int);
+    // Purpose: Starts timing a move and works out its soft and hard limits.
+    // Input:   int remaining - Milliseconds left on the engine's clock.
+    //          int increment - Milliseconds added after the move.
+    // Output:  None.
+    // Caller:  chessEngine::chooseMove();
+    //
+    void startFixed(int);
+    // Purpose: Starts timing a move that may take a fixed time, all of which is used: iterations are started
+    //          until the time is up, and the last one is cut off there.
+    // Input:   int moveTime - Milliseconds for the move.
+    // Output:  None.
+    // Caller:  chessTestSuite::solvePosition();
+    //
+    void newSearch();
+    // Purpose: Forgets the iterations of the last search.  Called by the search itself, so a pondering
+    //          search keeps what it learned before the ponder hit started the clock.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessSearch::search();
+    //
+    void recordIteration(chessMove, int);
+    // Purpose: Takes note of a completed iteration, to adjust the soft limit by how settled the search is.
+    // Input:   chessMove bestMove - Best move of the iteration.
+    //          int score - Its score.
+    // Output:  None.
+    // Caller:  chessSearch::search();
+    //
+    bool isIterationAllowed();
+    // Purpose: Checks whether there is time for another iteration.  Each one takes about as long as all
+    //          before it together, so one is only started while at most half the adjusted soft limit is used.
+    // Input:   None.
+    // Output:  Returns TRUE if the search should go one ply deeper.
+    // Caller:  chessSearch::search();
+    //
+    bool isPastHardLimit();
+    // Purpose: Checks whether the move has to be played now, in the middle of an iteration if need be.
+    // Input:   None.
+    // Output:  Returns TRUE once the hard limit has passed.
+    // Caller:  chessSearch::isOutOfBudget();
+    //
+    int getElapsed();
+    // Purpose: Returns the time spent on the move so far.
+    // Input:   None.
+    // Output:  int elapsed - Milliseconds since start().
+    // Caller:  chessTimeManager;
+    //
+
+private:
+    chrono::steady_clock::time_point startTime;
+    // When the move's time started.
+    int softLimit = 0, hardLimit = 0;
+    // Milliseconds to aim for and never to pass, before adjusting for stability.
+    bool isFixed = false;
+    // Set by startFixed(), when the move time does not depend on how the search goes.
+    chessMove lastBest = {{-1, -1}, {-1, -1}, NOPIECE};
+    // Best move of the last completed iteration, from.posX -1 if none yet.
+    int lastScore = 0;
+    // Score of the last completed iteration.
+    int stableIterations = 0;
+    // Number of iterations in a row that kept the same best move.
+    bool isBestChanging = false;
+    // Set when the last iteration found a different best move than the one before.
+    bool isScoreDropping = false;
+    // Set when the last iteration scored clearly worse than the one before.
+};
+
+#endif /* CHESSTIMEMANAGER_H */
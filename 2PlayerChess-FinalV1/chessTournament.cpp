@@ -0,0 +1,329 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessTournament.cpp
+ *      Purpose: Parallel engine self-play matches with early adjudication and an SPRT stopping rule.
+ *      Input: None.
+ *      Output: Progress lines and the final result on standard output.
+ *      Exceptions: None.
+ *
+ */
+
+#include "chessTournament.h"
+#include "chessThreadPool.h"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+    const int openingPlies = 8;
+    // random moves played to generate an opening
+    const int openingAttempts = 20;
+    // generated openings tried before an unbalanced one is accepted anyway
+    const int openingBalance = 150;
+    // centipawns either side may be ahead after a generated opening
+    const uint64_t openingSeed = 0x5eed0fc4e55ULL;
+    // seed of the opening generator, fixed so matches are repeatable
+
+    const int maxPlies = 400;
+    // games still going after this many plies are drawn
+    const int resignScore = 600;
+    const int resignPlies = 6;
+    // a game is won once both players' scores have agreed on a winner by at least resignScore for resignPlies
+    // plies in a row
+    const int drawScore = 10;
+    const int drawPlies = 12;
+    const int drawStartPly = 60;
+    // after drawStartPly, a game is drawn once both players have scored it within drawScore for drawPlies in a row
+    const int progressInterval = 20;
+    // games between progress lines
+
+    // splitmix64 step, the same generator chessHash uses for its keys
+    uint64_t nextRandom(uint64_t* state){
+        uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+}
+
+chessTournament::chessTournament() : nextGame(0), isFinished(false) {
+    threadCount = chessThreadPool::getShared().getConcurrency();
+    maxGames = 20000;
+    candidateLimits = {0, 1000};
+    baselineLimits = {0, 1000};
+    elo0 = 0;
+    elo1 = 10;
+    alpha = 0.05;
+    beta = 0.05;
+    wins = 0;
+    draws = 0;
+    losses = 0;
+    verdict = SPRT_PENDING;
+}
+
+void chessTournament::setThreadCount(int count){
+    threadCount = (count < 1) ? 1 : count;
+}
+
+void chessTournament::setPlayers(searchLimits candidate, searchLimits baseline){
+    candidateLimits = candidate;
+    baselineLimits = baseline;
+}
+
+void chessTournament::setSprt(double e0, double e1, double a, double b){
+    elo0 = e0;
+    elo1 = e1;
+    alpha = a;
+    beta = b;
+}
+
+void chessTournament::setMaxGames(int games){
+    maxGames = (games < 2) ? 2 : games + (games & 1);
+}
+
+bool chessTournament::loadOpenings(string path){
+    ifstream file(path);
+    string line;
+    if(!file.is_open()){
+        return false;
+    }
+    openings.clear();
+    chessGame game;
+    int lineNumber = 0;
+    while(getline(file, line)){
+        lineNumber++;
+        // blank lines and '#' comments are skipped, as in game archives
+        if(line.empty() || line[0] == '#' || line[0] == '\r'){
+            continue;
+        }
+        // every line is played through once now, since a game that cannot start from it would be abandoned
+        string_view text = line;
+        string_view token;
+        bool isPlayable = true;
+        game.resetGame();
+        while(isPlayable && chessNotation::nextMoveToken(&text, &token)){
+            isPlayable = game.playNotation(token, NULL);
+        }
+        if(!isPlayable || game.isGameOver()){
+            cout << "Skipping opening on line " << lineNumber << ": " << (isPlayable ? "the game is already over" : "illegal or unreadable move") << endl;
+            continue;
+        }
+        openings.push_back(line);
+    }
+    return !openings.empty();
+}
+
+sprtVerdict chessTournament::run(){
+    nextGame = 0;
+    isFinished = false;
+    wins = 0;
+    draws = 0;
+    losses = 0;
+    verdict = SPRT_PENDING;
+    
+    cout << "SPRT elo0 " << elo0 << " elo1 " << elo1 << " alpha " << alpha << " beta " << beta;
+    cout << ", bounds [" << log(beta / (1 - alpha)) << ", " << log((1 - beta) / alpha) << "]" << endl;
+    
+    // each worker task plays games one after another on the shared pool
+    chessThreadPool& pool = chessThreadPool::getShared();
+    chessTaskGroup workers;
+    for(int i = 0; i < threadCount; i++){
+        pool.submit(&workers, [this](){ tournamentWorker(); });
+    }
+    pool.wait(&workers);
+    
+    printProgress(getLogLikelihoodRatio());
+    switch(verdict){
+        case SPRT_ACCEPTED:
+            cout << "H1 accepted: the candidate is stronger." << endl;
+            break;
+        case SPRT_REJECTED:
+            cout << "H0 accepted: the candidate is not stronger." << endl;
+            break;
+        default:
+            cout << "Game limit reached before the SPRT decided." << endl;
+            break;
+    }
+    return verdict;
+}
+
+void chessTournament::tournamentWorker(){
+    chessGame game;
+    chessSearch candidate, baseline;
+    
+    while(!isFinished.load()){
+        int gameNumber = nextGame.fetch_add(1);
+        if(gameNumber >= maxGames){
+            return;
+        }
+        gameResult result = playGame(&game, &candidate, &baseline, gameNumber);
+        if(result != GAME_ABANDONED){
+            recordResult(result);
+        }
+    }
+}
+
+chessTournament::gameResult chessTournament::playGame(chessGame* game, chessSearch* candidate, chessSearch* baseline, int gameNumber){
+    // results from the previous game would make every game depend on the ones played before it on this thread
+    candidate->clearTable();
+    baseline->clearTable();
+    if(!playOpening(game, candidate, gameNumber / 2)){
+        return GAME_ABANDONED;
+    }
+    
+    color candidateColor = (gameNumber % 2 == 0) ? WHITE : BLACK;
+    color mover = game->getActivePlayer();
+    int resignCount = 0, drawCount = 0, lastWinner = 0;
+    
+    for(int ply = 0; ply < maxPlies; ply++){
+        if(isFinished.load(memory_order_relaxed)){
+            return GAME_ABANDONED;
+        }
+        
+        chessSearch* player = (mover == candidateColor) ? candidate : baseline;
+        game->setupSearch(player);
+        
+        // dead draws need no search; this is the only endgame knowledge there is to adjudicate with
+        if(player->isInsufficientMaterial()){
+            return RESULT_DRAW;
+        }
+        searchResult result = player->search((mover == candidateColor) ? candidateLimits : baselineLimits);
+        if(result.bestMove.from.posX < 0){
+            // no legal move: mated positions end in playMove() already, so this is stalemate
+            if(result.score == 0){
+                return RESULT_DRAW;
+            }
+            return (mover == candidateColor) ? CANDIDATE_LOSS : CANDIDATE_WIN;
+        }
+        
+        // adjudicate on the scores of both players, seen from WHITE's side
+        int whiteScore = (mover == WHITE) ? result.score : -result.score;
+        int winner = (whiteScore >= resignScore) ? 1 : (whiteScore <= -resignScore) ? -1 : 0;
+        resignCount = (winner != 0 && winner == lastWinner) ? resignCount + 1 : (winner != 0) ? 1 : 0;
+        lastWinner = winner;
+        drawCount = (ply >= drawStartPly && abs(whiteScore) <= drawScore) ? drawCount + 1 : 0;
+        if(resignCount >= resignPlies){
+            return ((winner > 0) == (candidateColor == WHITE)) ? CANDIDATE_WIN : CANDIDATE_LOSS;
+        }
+        if(drawCount >= drawPlies){
+            return RESULT_DRAW;
+        }
+        
+        game->playMove(result.bestMove);
+        switch(game->getGameState()){
+            case CHECKMATE:
+                return (mover == candidateColor) ? CANDIDATE_WIN : CANDIDATE_LOSS;
+            case DRAW:
+                return RESULT_DRAW;
+            default:
+                break;
+        }
+        mover = game->getActivePlayer();
+    }
+    return RESULT_DRAW;
+}
+
+bool chessTournament::playOpening(chessGame* game, chessSearch* search, int opening){
+    if(!openings.empty()){
+        string_view text = openings.at(opening % openings.size());
+        string_view token;
+        game->resetGame();
+        while(chessNotation::nextMoveToken(&text, &token)){
+            if(!game->playNotation(token, NULL)){
+                return false;
+            }
+        }
+        return !game->isGameOver();
+    }
+    
+    uint64_t state = openingSeed + opening;
+    vector<chessMove> moves;
+    for(int attempt = 0; attempt < openingAttempts; attempt++){
+        game->resetGame();
+        for(int ply = 0; ply < openingPlies && !game->isGameOver(); ply++){
+            moves.clear();
+            game->getLegalMoves(&moves);
+            if(moves.empty()){
+                break;
+            }
+            game->playMove(moves.at(nextRandom(&state) % moves.size()));
+        }
+        if(game->isGameOver() || game->getGameState() == CHECK){
+            continue;
+        }
+        // a short search tells whether the random moves gave one side away
+        game->setupSearch(search);
+        searchResult result = search->search({2, 0});
+        if(abs(result.score) <= openingBalance || attempt == openingAttempts - 1){
+            return true;
+        }
+    }
+    return false;
+}
+
+void chessTournament::recordResult(gameResult result){
+    lock_guard<mutex> lock(resultLock);
+    if(verdict != SPRT_PENDING){
+        return;
+    }
+    switch(result){
+        case CANDIDATE_WIN:
+            wins++;
+            break;
+        case CANDIDATE_LOSS:
+            losses++;
+            break;
+        default:
+            draws++;
+            break;
+    }
+    
+    double llr = getLogLikelihoodRatio();
+    if(llr >= log((1 - beta) / alpha)){
+        verdict = SPRT_ACCEPTED;
+    }
+    else if(llr <= log(beta / (1 - alpha))){
+        verdict = SPRT_REJECTED;
+    }
+    int games = wins + draws + losses;
+    if(verdict != SPRT_PENDING || games >= maxGames){
+        isFinished = true;
+    }
+    else if(games % progressInterval == 0){
+        printProgress(llr);
+    }
+}
+
+double chessTournament::getLogLikelihoodRatio(){
+    double games = wins + draws + losses;
+    if(games == 0){
+        return 0;
+    }
+    // mean and variance of the score of one game. Half a pseudo-game of each result keeps the variance above
+    // zero when every game so far ended the same way, so a one-sided match still reaches a verdict early.
+    double score = (wins + 0.5 * draws) / games;
+    double variance = ((wins + 0.5) * (1 - score) * (1 - score) + (draws + 0.5) * (0.5 - score) * (0.5 - score)
+                      + (losses + 0.5) * score * score) / (games + 1.5);
+    // expected scores under the two hypotheses, from the logistic Elo model
+    double score0 = 1 / (1 + pow(10, -elo0 / 400));
+    double score1 = 1 / (1 + pow(10, -elo1 / 400));
+    return games * (score1 - score0) * (2 * score - score0 - score1) / (2 * variance);
+}
+
+void chessTournament::printProgress(double llr){
+    int games = wins + draws + losses;
+    double score = (games > 0) ? (wins + 0.5 * draws) / games : 0.5;
+    char elo[32];
+    if(score <= 0 || score >= 1){
+        snprintf(elo, sizeof(elo), "%s", (score <= 0) ? "-inf" : "+inf");
+    }
+    else{
+        snprintf(elo, sizeof(elo), "%+.1f", 0.0 - 400 * log10(1 / score - 1));
+    }
+    char line[160];
+    snprintf(line, sizeof(line), "Games %d  W-D-L %d-%d-%d  Elo %s  LLR %.2f", games, wins, draws, losses, elo, llr);
+    cout << line << endl;
+}
@@ -0,0 +1,162 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessTournament.h
+ *      Purpose: Plays engine against engine self-play matches to measure whether a change to the search is an
+ *               improvement.  Worker tasks on the shared thread pool each drive their own headless chessGame with two chessSearch
+ *               players, a candidate and a baseline, which differ in their search limits.  Every opening is
+ *               played twice with the colors swapped.  Games are adjudicated early once they are clearly
+ *               decided, and the match stops on its own as soon as a sequential probability ratio test (SPRT)
+ *               accepts or rejects the candidate.
+ *      Input: Search limits of both players, SPRT bounds, and optionally a file of opening lines in the archive
+ *             format used by chessIndex.
+ *      Output: Progress lines and the final result on standard output.
+ *      Exceptions: An openings file that cannot be read is reported through the return value of loadOpenings();
+ *                  unusable lines are skipped with a message.
+ *
+ */
+
+#ifndef CHESSTOURNAMENT_H
+#define CHESSTOURNAMENT_H
+#include <cstdlib>
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "globals.h"
+#include "chessGame.h"
+#include "chessSearch.h"
+
+using namespace std;
+
+    enum sprtVerdict{SPRT_PENDING, SPRT_ACCEPTED, SPRT_REJECTED};
+    // Outcome of the SPRT: still undecided, candidate stronger by at least elo1 (H1), or not stronger than elo0 (H0).
+
+class chessTournament {
+public:
+    chessTournament();
+    // Purpose: Default constructor. Uses every available core, 1000 nodes a move for both players, at most
+    //          20000 games and an SPRT of elo0 = 0 against elo1 = 10 with 5% error rates.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  main();
+    //
+    void setThreadCount(int);
+    // Purpose: Sets the number of games played at the same time, at most as many as the shared chessThreadPool
+    //          has threads.
+    // Input:   int count - Number of worker tasks, at least 1.
+    // Output:  None.
+    // Caller:  main();
+    //
+    void setPlayers(searchLimits, searchLimits);
+    // Purpose: Sets the search limits of the two players.
+    // Input:   searchLimits candidate - Limits of the player under test.
+    //          searchLimits baseline - Limits of the reference player.
+    // Output:  None.
+    // Caller:  main();
+    //
+    void setSprt(double, double, double, double);
+    // Purpose: Sets the hypotheses and error rates of the SPRT.
+    // Input:   double elo0 - Elo difference of H0, the candidate is no better than this.
+    //          double elo1 - Elo difference of H1, the candidate is better by at least this.
+    //          double alpha - Probability of accepting H1 when H0 holds.
+    //          double beta - Probability of accepting H0 when H1 holds.
+    // Output:  None.
+    // Caller:  main();
+    //
+    void setMaxGames(int);
+    // Purpose: Sets the number of games after which the match ends even if the SPRT is still undecided.
+    // Input:   int games - Maximum number of games, rounded up to whole pairs.
+    // Output:  None.
+    // Caller:  main();
+    //
+    bool loadOpenings(string);
+    // Purpose: Reads opening lines to start games from instead of generated openings.  Lines with an illegal
+    //          or unreadable move, or that end the game, are skipped with a message.
+    // Input:   string path - Text file with one opening per line, moves in SAN or coordinate notation.
+    // Output:  Returns FALSE if the file could not be read or held no openings.
+    // Caller:  main();
+    //
+    sprtVerdict run();
+    // Purpose: Plays the match until the SPRT decides or the game limit is reached, printing progress as
+    //          games finish.
+    // Input:   None.
+    // Output:  sprtVerdict verdict - Outcome of the SPRT, SPRT_PENDING if the game limit came first.
+    // Caller:  main();
+    //
+    
+private:
+    enum gameResult{CANDIDATE_WIN, RESULT_DRAW, CANDIDATE_LOSS, GAME_ABANDONED};
+    // Result of one game for the candidate. Abandoned games were cut short by the end of the match.
+    
+    void tournamentWorker();
+    // Purpose: Worker task. Takes game numbers and plays them until the match is over.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessTournament::run();
+    //
+    gameResult playGame(chessGame*, chessSearch*, chessSearch*, int);
+    // Purpose: Plays one game from its opening to the end, or until it is adjudicated.
+    // Input:   chessGame* game - Headless game instance owned by the calling worker.
+    //          chessSearch* candidate - Search of the candidate player.
+    //          chessSearch* baseline - Search of the baseline player.
+    //          int gameNumber - Number of the game. Games 2n and 2n+1 share opening n, with the candidate
+    //          playing WHITE in the even game.
+    // Output:  gameResult result - The result for the candidate.
+    // Caller:  chessTournament::tournamentWorker();
+    //
+    bool playOpening(chessGame*, chessSearch*, int);
+    // Purpose: Sets up the game at the position after an opening: a line from the openings file, or a few
+    //          random legal moves chosen by a generator seeded with the opening number, so every game pair
+    //          starts from the same position on any machine. Generated openings that leave one side clearly
+    //          ahead are drawn again.
+    // Input:   chessGame* game - The game to set up.
+    //          chessSearch* search - Search used to judge generated openings.
+    //          int opening - Number of the opening.
+    // Output:  Returns FALSE if the opening could not be played.
+    // Caller:  chessTournament::playGame();
+    //
+    void recordResult(gameResult);
+    // Purpose: Counts a finished game, prints progress and ends the match once the SPRT decides.
+    // Input:   gameResult result - Result of the game for the candidate.
+    // Output:  None.
+    // Caller:  chessTournament::tournamentWorker();
+    //
+    double getLogLikelihoodRatio();
+    // Purpose: Computes the log-likelihood ratio of H1 against H0 from the results so far, using the normal
+    //          approximation of the game score distribution.
+    // Input:   None.
+    // Output:  double llr - The log-likelihood ratio, 0 before the first result.
+    // Caller:  chessTournament::recordResult();
+    //
+    void printProgress(double);
+    // Purpose: Prints one line with the games played, the results, the Elo estimate and the LLR.
+    // Input:   double llr - The current log-likelihood ratio.
+    // Output:  None.
+    // Caller:  chessTournament::recordResult(); chessTournament::run();
+    //
+    
+    int threadCount;
+    // Number of games played at the same time.
+    int maxGames;
+    // Number of games after which the match ends.
+    searchLimits candidateLimits, baselineLimits;
+    // Search limits of the two players.
+    double elo0, elo1, alpha, beta;
+    // SPRT hypotheses and error rates.
+    vector<string> openings;
+    // Opening lines from loadOpenings(), empty to generate openings.
+    atomic<int> nextGame;
+    // Number of the next game to hand to a worker.
+    atomic<bool> isFinished;
+    // Set once the SPRT has decided or the game limit was reached.
+    mutex resultLock;
+    // Guards the result counters and the verdict.
+    int wins, draws, losses;
+    // Results of the candidate so far.
+    sprtVerdict verdict;
+    // Outcome of the SPRT once decided.
+};
+
+#endif /* CHESSTOURNAMENT_H */
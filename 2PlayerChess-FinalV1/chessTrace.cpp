@@ -0,0 +1,101 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessTrace.cpp
+ *      Purpose: Scoped trace spans recorded into a lock-free ring buffer and exported as Chrome trace JSON.
+ *               Only compiled in when the program is built with -DCHESS_TRACE.
+ *      Input: None.
+ *      Output: JSON trace file.
+ *      Exceptions: None.
+ *
+ */
+
+#include "chessTrace.h"
+
+#ifdef CHESS_TRACE
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+
+namespace {
+
+    const uint64_t traceCapacity = 1 << 16;
+    // number of events kept, must be a power of two
+
+    // one recorded span. sequence is written last, once the rest of the slot holds a complete event, and is the
+    // index of the event plus one, so the exporter can skip slots that are empty or being overwritten.
+    struct traceEvent {
+        atomic<uint64_t> sequence;
+        const char* name;
+        uint64_t start;
+        uint64_t duration;
+        uint32_t threadId;
+    };
+
+    traceEvent traceRing[traceCapacity];
+    atomic<uint64_t> traceNext(0);
+    atomic<uint32_t> traceThreads(0);
+    thread_local uint32_t traceThreadId = ++traceThreads;
+    const uint64_t traceEpoch = chessTrace::now();
+}
+
+uint64_t chessTrace::now(){
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void chessTrace::record(const char* name, uint64_t start, uint64_t end){
+    // claim the next slot; writers never wait on each other
+    uint64_t index = traceNext.fetch_add(1, memory_order_relaxed);
+    traceEvent& event = traceRing[index & (traceCapacity - 1)];
+    event.sequence.store(0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    event.name = name;
+    event.start = start;
+    event.duration = end - start;
+    event.threadId = traceThreadId;
+    event.sequence.store(index + 1, memory_order_release);
+}
+
+bool chessTrace::exportJson(string path){
+    FILE* file = fopen(path.c_str(), "w");
+    if(file == NULL){
+        return false;
+    }
+
+    uint64_t last = traceNext.load(memory_order_acquire);
+    uint64_t first = (last > traceCapacity) ? last - traceCapacity : 0;
+    bool isFirst = true;
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", file);
+    for(uint64_t i = first; i < last; i++){
+        traceEvent& event = traceRing[i & (traceCapacity - 1)];
+        if(event.sequence.load(memory_order_acquire) != i + 1){
+            continue;
+        }
+        // copy the event, then make sure no writer reused the slot meanwhile
+        const char* name = event.name;
+        uint64_t start = event.start;
+        uint64_t duration = event.duration;
+        uint32_t threadId = event.threadId;
+        atomic_thread_fence(memory_order_acquire);
+        if(event.sequence.load(memory_order_relaxed) != i + 1){
+            continue;
+        }
+        // Chrome trace timestamps are microseconds
+        fprintf(file, "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                isFirst ? "" : ",", name, threadId, (start - traceEpoch) / 1000.0, duration / 1000.0);
+        isFirst = false;
+    }
+    fputs("\n]}\n", file);
+    return fclose(file) == 0;
+}
+
+chessTraceSpan::chessTraceSpan(const char* name){
+    spanName = name;
+    startTime = chessTrace::now();
+}
+
+chessTraceSpan::~chessTraceSpan(){
+    chessTrace::record(spanName, startTime, chessTrace::now());
+}
+
+#endif /* CHESS_TRACE */
@@ -0,0 +1,85 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessTrace.h
+ *      Purpose: Scoped trace spans for measuring where the time of a turn goes.  Spans are recorded into a fixed
+ *               size lock-free ring buffer, keeping the most recent events of long games, and exported in the
+ *               Chrome trace event format that chrome://tracing and Perfetto open directly.
+ *               Tracing only exists when the program is built with -DCHESS_TRACE.  Otherwise CHESS_TRACE_SPAN
+ *               expands to nothing and no tracing code or data is compiled in.
+ *      Input: None.
+ *      Output: JSON trace file, see chessTrace::exportJson().
+ *      Exceptions: None. A trace file that cannot be written is reported through the return value.
+ *
+ */
+
+#ifndef CHESSTRACE_H
+#define CHESSTRACE_H
+
+#ifdef CHESS_TRACE
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+#include "globals.h"
+
+using namespace std;
+
+class chessTrace {
+public:
+    static uint64_t now();
+    // Purpose: Returns the current time of the trace clock.
+    // Input:   None.
+    // Output:  uint64_t time - Nanoseconds of a monotonic clock.
+    // Caller:  chessTraceSpan;
+    //
+    static void record(const char*, uint64_t, uint64_t);
+    // Purpose: Adds a finished span to the ring buffer, overwriting the oldest event once it is full.
+    // Input:   const char* name - Name of the span. Must be a string literal or otherwise outlive the trace.
+    //          uint64_t start - Start time from now().
+    //          uint64_t end - End time from now().
+    // Output:  None.
+    // Caller:  chessTraceSpan::~chessTraceSpan();
+    //
+    static bool exportJson(string);
+    // Purpose: Writes every event still in the ring buffer as a Chrome trace JSON file.
+    // Input:   string path - Path of the file to write.
+    // Output:  Returns FALSE if the file could not be written.
+    // Caller:  chessGame::endGame();
+    //
+};
+
+class chessTraceSpan {
+public:
+    chessTraceSpan(const char*);
+    // Purpose: Starts a span that lasts until the end of the enclosing scope.
+    // Input:   const char* name - Name of the span, a string literal.
+    // Output:  None.
+    // Caller:  CHESS_TRACE_SPAN;
+    //
+    ~chessTraceSpan();
+    // Purpose: Ends the span and records it.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  None;
+    //
+
+private:
+    const char* spanName;
+    // Name given to the span.
+    uint64_t startTime;
+    // Time the span started at.
+};
+
+#define CHESS_TRACE_JOIN(a, b) a##b
+#define CHESS_TRACE_NAME(line) CHESS_TRACE_JOIN(traceSpan, line)
+#define CHESS_TRACE_SPAN(name) chessTraceSpan CHESS_TRACE_NAME(__LINE__)(name)
+// Times the rest of the enclosing scope under the given name.
+
+#else
+
+#define CHESS_TRACE_SPAN(name)
+// Tracing is compiled out.
+
+#endif /* CHESS_TRACE */
+
+#endif /* CHESSTRACE_H */
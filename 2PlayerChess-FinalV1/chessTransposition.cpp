@@ -0,0 +1,81 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessTransposition.cpp
+ *      Purpose: Hash table of searched positions for chessSearch.
+ *      Input: None.
+ *      Output: None.
+ *      Exceptions: None.
+ *
+ */
+
+#include "chessTransposition.h"
+
+chessTransposition::chessTransposition() {
+    slots.assign(size_t(1) << defaultSizeBits, tableSlot{0, 0, 0, BOUND_NONE, 0, 0, NOPIECE, 0});
+    indexMask = (slots.size() - 1) & ~uint64_t(1);
+}
+
+void chessTransposition::newSearch(){
+    generation++;
+}
+
+void chessTransposition::clear(){
+    for(size_t i = 0; i < slots.size(); i++){
+        slots[i] = tableSlot{0, 0, 0, BOUND_NONE, 0, 0, NOPIECE, 0};
+    }
+    generation = 0;
+}
+
+bool chessTransposition::probe(uint64_t key, transpositionEntry* entry){
+    const tableSlot* pair = &slots[key & indexMask];
+    for(int i = 0; i < 2; i++){
+        const tableSlot& slot = pair[i];
+        if(slot.bound == BOUND_NONE || slot.key != key){
+            continue;
+        }
+        if(slot.from == slot.to){
+            entry->move = {{-1, -1}, {-1, -1}, NOPIECE};
+        }
+        else{
+            entry->move = {{slot.from / 8, slot.from % 8}, {slot.to / 8, slot.to % 8}, chessPieceType(slot.promotion)};
+        }
+        entry->score = slot.score;
+        entry->depth = slot.depth;
+        entry->bound = scoreBound(slot.bound);
+        return true;
+    }
+    return false;
+}
+
+void chessTransposition::store(uint64_t key, chessMove move, int score, int depth, scoreBound bound){
+    tableSlot* pair = &slots[key & indexMask];
+    tableSlot* slot;
+    if(pair[0].key == key && pair[0].bound != BOUND_NONE){
+        slot = &pair[0];
+    }
+    else if(pair[1].key == key && pair[1].bound != BOUND_NONE){
+        slot = &pair[1];
+    }
+    else{
+        // the first slot only gives way to a deeper entry, or to any entry once its search is over
+        bool isReplaceable = pair[0].bound == BOUND_NONE || pair[0].generation != generation || depth >= pair[0].depth;
+        slot = isReplaceable ? &pair[0] : &pair[1];
+    }
+    
+    // a shallower result must not push out a deeper one of the same position, unless it is exact
+    if(slot->key == key && slot->bound != BOUND_NONE && depth < slot->depth && bound != BOUND_EXACT){
+        return;
+    }
+    // a result without a move keeps the move already known for the position
+    if(move.from.posX >= 0 || slot->key != key){
+        slot->from = (move.from.posX >= 0) ? move.from.posX * 8 + move.from.posY : 0;
+        slot->to = (move.from.posX >= 0) ? move.to.posX * 8 + move.to.posY : 0;
+        slot->promotion = move.promotion;
+    }
+    slot->key = key;
+    slot->score = score;
+    slot->depth = depth;
+    slot->bound = bound;
+    slot->generation = generation;
+}
@@ -0,0 +1,86 @@
+/*      Author: Drew Tibbetts
+ *      Creation Date: 10/19/2026
+ *      Modification: 10/19/2026
+ *      FileName: chessTransposition.h
+ *      Purpose: Transposition table for the search.  Remembers, by position hash, the score, depth and best move
+ *               of positions already searched, so a position reached again by another move order or in the
+ *               next iteration is not searched from scratch, and its best move is tried first.  Slots come in
+ *               pairs: the first keeps the deepest entry of the current search, the second always takes the
+ *               newest, so deep results survive a flood of shallow ones and the principal variation can be
+ *               read back from the table.
+ *      Input: Positions searched by chessSearch, see store().
+ *      Output: Entries of positions searched before, see probe().
+ *      Exceptions: None.
+ *
+ */
+
+#ifndef CHESSTRANSPOSITION_H
+#define CHESSTRANSPOSITION_H
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+#include "globals.h"
+
+using namespace std;
+
+    enum scoreBound{BOUND_NONE, BOUND_EXACT, BOUND_LOWER, BOUND_UPPER};
+    // What a stored score says about the position: its exact score, at least the score after a beta cutoff, or
+    // at most the score when no move raised alpha.
+    struct transpositionEntry {chessMove move; int score; int depth; scoreBound bound;};
+    // What the table knows about a position: its best move, from.posX -1 if none, its score and bound, and the
+    // remaining depth it was searched to.
+
+class chessTransposition {
+public:
+    chessTransposition();
+    // Purpose: Default constructor. Allocates a table of defaultSizeBits.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessSearch::chessSearch();
+    //
+    void newSearch();
+    // Purpose: Marks the start of a search. Entries of earlier searches stay usable but give way to new ones.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessSearch::search();
+    //
+    void clear();
+    // Purpose: Empties every slot, so a new game starts without entries from an old one.
+    // Input:   None.
+    // Output:  None.
+    // Caller:  chessSearch::clearTable();
+    //
+    bool probe(uint64_t, transpositionEntry*);
+    // Purpose: Looks a position up.
+    // Input:   uint64_t key - Hash of the position.
+    //          transpositionEntry* entry - Receives the entry when found.
+    // Output:  Returns TRUE if the position has an entry.
+    // Caller:  chessSearch::alphaBeta(); chessSearch::readLine();
+    //
+    void store(uint64_t, chessMove, int, int, scoreBound);
+    // Purpose: Records the outcome of searching a position.
+    // Input:   uint64_t key - Hash of the position.
+    //          chessMove move - Best move found, from.posX -1 if none.
+    //          int score - Score for the side to move, mate scores relative to the position.
+    //          int depth - Remaining depth the position was searched to.
+    //          scoreBound bound - What the score says about the position.
+    // Output:  None.
+    // Caller:  chessSearch::alphaBeta();
+    //
+
+private:
+    struct tableSlot {uint64_t key; int16_t score; int8_t depth; uint8_t bound; uint8_t from, to, promotion, generation;};
+    // One slot as stored, 16 bytes: the full key, the entry with the move packed into square numbers, and the
+    // search that stored it. from equals to when there is no move. bound is BOUND_NONE for an empty slot.
+
+    static const int defaultSizeBits = 18;
+    // The table holds 2^defaultSizeBits slots, 4MB.
+    vector<tableSlot> slots;
+    // The slots, in pairs indexed by the low bits of the key.
+    uint64_t indexMask = 0;
+    // Number of slots minus one, with the lowest bit clear so it selects the first slot of a pair.
+    uint8_t generation = 0;
+    // Number of the current search, wrapping around.
+};
+
+#endif /* CHESSTRANSPOSITION_H */
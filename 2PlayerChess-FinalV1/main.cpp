@@ -1,99 +1,463 @@
-/*
- * To change this license header, choose License Headers in Project Properties.
- * To change this template file, choose Tools | Templates
- * and open the template in the editor.
- */
-
-/* 
- * File:   main.cpp
- * Author: Drew
- *
- * Created on July 22, 2019, 6:17 PM
- */
-
-#include <cstdlib>
-#include <iostream>
-#include "globals.h"
-#include "chessGame.h"
-
-using namespace std;
-
-chessGame activeGame;
-
-/*
- * 
- */
-int main(int argc, char** argv) {
-    
-    int menuSelection;
-    do{
-    
-        
-    cout << "----------------------" << endl;    
-    cout << "||| 2 PLAYER CHESS |||" << endl;
-    cout << "----------------------" << endl;
-    cout << "       MAIN MENU      " << endl;
-    cout << "       ---------      " << endl;
-    cout << " Enter the number that" << endl;
-    cout << "matches the menu option" << endl;
-    cout << "       ---------      " << endl;
-    cout << "  1. Start New Game   " << endl;
-    cout << "  2. Program Tutorial " << endl;
-    cout << "  3. Software Info    " << endl;
-    cout << "  4. Exit Program     " << endl;
-    cout << "       ---------      " << endl;
-    cout << "Enter your selection: ";
-    cin >> (cin, menuSelection);
-    
-    switch(menuSelection){
-        case 1:
-            cout << "------------------------" << endl;
-            cout << "|||  Start New Game  |||" << endl;
-            cout << "------------------------" << endl;
-            activeGame.startNewGame();
-            activeGame.endGame();
-            break;
-        case 2:
-            cout << "------------------------" << endl;
-            cout << "||| Program Tutorial |||" << endl;
-            cout << "------------------------" << endl;
-            cout << "Select 'Start New Game' to begin." << endl;
-            cout << "Each player, starting with WHITE, will enter two pairs of coordinates:" << endl;
-            cout << "STARTING Coordinates: The position for the starting chess piece." << endl;
-            cout << "ENDING Coordinates: The desired destination for the chosen piece." << endl;
-            cout << "Moves are entered in the form of Standard Algebraic Notation (SAN)" << endl;
-            cout << "For example, bottom left corner of the board is A1, while top right corner of the board is H8" << endl;
-            cout << "The game ends when a player is in CHECKMATE, or the chess board becomes a STALEMATE" << endl;
-            cout << "Good luck!" << endl;
-            cout << "Returning to main menu..." << endl;
-            cout << "------------------------" << endl << endl;
-             break;
-        case 3:
-            cout << "------------------------" << endl;
-            cout << "|||   Software Info   |||" << endl;
-            cout << "------------------------" << endl;
-            cout << "This program was developed in C++ by Drew Tibbetts for COP2350C Section 01 Advanced C++ Programming" << endl;
-            cout << "Returning to main menu..." << endl;
-            cout << "------------------------" << endl << endl;
-            break;
-        case 4:
-            cout << "------------------------" << endl;
-            cout << "|||   Exit Program   |||" << endl;
-            cout << "------------------------" << endl;
-            cout << "Thank you for playing! Exiting program..." << endl;
-            cout << "------------------------" << endl << endl;
-            exit(0); 
-            break;
-        default:
-            cout << "------------------------" << endl;
-            cout <<"Please enter a valid menu selection between 1 and 4." << endl;
-            cout << "------------------------" << endl << endl;
-            cin.clear();
-            cin.ignore(1000,'\n');
-            break;  
-    }
-    }while(menuSelection != 4);       
-    
-    return 0;
-}
-
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/* 
+ * File:   main.cpp
+ * Author: Drew
+ *
+ * Created on July 22, 2019, 6:17 PM
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include "globals.h"
+#include "chessGame.h"
+#include "chessIndex.h"
+#include "chessInput.h"
+#include "chessEventStream.h"
+#include "chessStats.h"
+#include "chessTestSuite.h"
+#include "chessTournament.h"
+
+using namespace std;
+
+chessGame activeGame;
+chessInput consoleInput;
+chessEventStream eventStream;
+const int maxMateDistance = 256;
+// scores within this many plies of chessSearch::mateScore are printed as mates
+
+/*
+ * Command line tools, run instead of the interactive menu when arguments are given.
+ *   --build-index <archive> <index>      Builds a position index over an archive of games.
+ *   --find-position <index> [moves...]   Lists the games that reached the position after the given moves.
+ *   --export-san <archive>               Rewrites every game of an archive in SAN, one game per line.
+ *   --resume <snapshot>                  Continues a game saved with "save <file>" during play.
+ *   --engine <white|black> [options]     Plays a game against the engine, which takes the given side.
+ *   --perft <depth> [fen]                Counts the move sequences of a given length from a position.
+ *   --analyze <lines> <depth> [fen]      Lists the best few moves of a position with their scores and lines.
+ *   --tournament [options]               Plays an engine self-play match until an SPRT decides.
+ *   --epd <file> [options]               Searches the positions of an EPD test suite and reports the solve rate.
+ * Any of them may be followed by --stats to print the engine's performance counters to stderr when done.
+ * --events <fd|file> or --binary-events <fd|file>, given first, also reports the events of the game played on
+ * the console, from the menu, --resume or --engine, to a file descriptor or file, as JSON lines or binary
+ * records.  The games of --tournament and --epd are not reported.
+ */
+int runCommandLine(int argc, char** argv) {
+    
+    string command = argv[1];
+    
+    if(command == "--build-index" && argc == 4){
+        chessIndex index;
+        auto start = chrono::steady_clock::now();
+        if(!index.buildIndex(argv[2], argv[3])){
+            cout << "Could not build index from " << argv[2] << endl;
+            return 1;
+        }
+        auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+        cout << "Indexed " << index.getGamesIndexed() << " games (" << index.getGamesRejected() << " stopped early), ";
+        cout << index.getRecordCount() << " positions in " << elapsed.count() << " ms" << endl;
+        return 0;
+    }
+    
+    if(command == "--find-position" && argc >= 3){
+        // replay the given moves from the starting position to reach the position to look up
+        activeGame.resetGame();
+        for(int i = 3; i < argc; i++){
+            if(!activeGame.playNotation(argv[i], NULL)){
+                cout << "Illegal move: " << argv[i] << endl;
+                return 1;
+            }
+        }
+        chessIndex index;
+        auto start = chrono::steady_clock::now();
+        vector<indexRecord> matches = index.findPosition(argv[2], activeGame.getPositionHash());
+        auto elapsed = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+        for(int i = 0; i < matches.size(); i++){
+            cout << "game " << matches.at(i).gameId << " ply " << matches.at(i).ply << endl;
+        }
+        cout << matches.size() << " occurrences found in " << elapsed.count() << " us" << endl;
+        return 0;
+    }
+    
+    if(command == "--export-san" && argc == 3){
+        ifstream archive(argv[2]);
+        if(!archive.is_open()){
+            cout << "Could not open " << argv[2] << endl;
+            return 1;
+        }
+        string line, output;
+        char san[12];
+        while(getline(archive, line)){
+            if(line.empty() || line[0] == '#' || line[0] == '\r'){
+                continue;
+            }
+            // every move is written in SAN before it is played, the game line stops at the first illegal move
+            activeGame.resetGame();
+            output.clear();
+            string_view text = line;
+            string_view token;
+            while(chessNotation::nextMoveToken(&text, &token) && activeGame.playNotation(token, san)){
+                output += (output.empty()) ? "" : " ";
+                output += san;
+            }
+            cout << output << "\n";
+        }
+        cout.flush();
+        return 0;
+    }
+    
+    if(command == "--resume" && argc == 3){
+        ifstream file(argv[2], ios::binary);
+        string snapshot((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+        if(!file.is_open() || !activeGame.loadSnapshot(snapshot)){
+            cout << "Could not resume a game from " << argv[2] << endl;
+            return 1;
+        }
+        activeGame.setInputSource(&consoleInput);
+        activeGame.resumeGame();
+        activeGame.endGame();
+        return 0;
+    }
+    
+    if(command == "--engine" && argc >= 3){
+        string side = argv[2];
+        searchLimits limits = {0, 400000};
+        bool isLimitSet = false;
+        bool ponder = true;
+        double baseTime = 0, increment = 0;
+        if(side != "white" && side != "black"){
+            cout << "The engine plays white or black" << endl;
+            return 1;
+        }
+        for(int i = 3; i < argc; i++){
+            string option = argv[i];
+            if(option == "--nodes" && i + 1 < argc){
+                limits.nodes = strtoull(argv[++i], NULL, 10);
+                isLimitSet = true;
+            }
+            else if(option == "--depth" && i + 1 < argc){
+                limits.depth = atoi(argv[++i]);
+                isLimitSet = true;
+            }
+            else if(option == "--clock" && i + 2 < argc){
+                baseTime = atof(argv[++i]);
+                increment = atof(argv[++i]);
+            }
+            else if(option == "--no-ponder"){
+                ponder = false;
+            }
+            else{
+                cout << "Unknown engine option " << option << endl;
+                return 1;
+            }
+        }
+        // on a clock the engine's moves are timed, so the default node limit only applies without one
+        if(baseTime > 0 && !isLimitSet){
+            limits = {0, 0};
+        }
+        if(limits.depth == 0 && limits.nodes == 0 && baseTime <= 0){
+            cout << "The engine needs a depth or node limit, or a clock" << endl;
+            return 1;
+        }
+        activeGame.setEngine((side == "white") ? WHITE : BLACK, limits, ponder);
+        activeGame.setClock(int(baseTime * 1000), int(increment * 1000));
+        activeGame.setInputSource(&consoleInput);
+        activeGame.startNewGame();
+        activeGame.endGame();
+        return 0;
+    }
+    
+    if(command == "--perft" && argc >= 3){
+        // the FEN position may be passed as one argument or as several
+        string fen;
+        for(int i = 3; i < argc; i++){
+            fen += (fen.empty()) ? "" : " ";
+            fen += argv[i];
+        }
+        if(!fen.empty() && !activeGame.loadPosition(fen)){
+            cout << "Invalid FEN position: " << fen << endl;
+            return 1;
+        }
+        if(fen.empty()){
+            activeGame.resetGame();
+        }
+        int depth = atoi(argv[2]);
+        if(depth < 1){
+            cout << "Depth must be at least 1" << endl;
+            return 1;
+        }
+        vector<string> divide;
+        auto start = chrono::steady_clock::now();
+        uint64_t nodes = activeGame.perft(depth, &divide);
+        auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+        for(int i = 0; i < divide.size(); i++){
+            cout << divide.at(i) << "\n";
+        }
+        cout << "Nodes: " << nodes << " in " << elapsed.count() << " ms" << endl;
+        return 0;
+    }
+    
+    if(command == "--analyze" && argc >= 4){
+        string fen;
+        for(int i = 4; i < argc; i++){
+            fen += (fen.empty()) ? "" : " ";
+            fen += argv[i];
+        }
+        if(!fen.empty() && !activeGame.loadPosition(fen)){
+            cout << "Invalid FEN position: " << fen << endl;
+            return 1;
+        }
+        if(fen.empty()){
+            activeGame.resetGame();
+        }
+        int lineCount = atoi(argv[2]), depth = atoi(argv[3]);
+        if(lineCount < 1 || depth < 1){
+            cout << "Lines and depth must be at least 1" << endl;
+            return 1;
+        }
+        
+        // all lines come out of one search, they only differ in how far alpha may rise at the root
+        chessSearch search;
+        vector<searchLine> lines;
+        activeGame.setupSearch(&search);
+        search.setLineCount(lineCount);
+        auto start = chrono::steady_clock::now();
+        searchResult result = search.search({depth, 0});
+        auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+        search.getLines(&lines);
+        cout << "Depth " << result.depth << ", " << result.nodes << " nodes in " << elapsed.count() << " ms" << endl;
+        for(int i = 0; i < lines.size(); i++){
+            char score[16];
+            int mateDistance = chessSearch::mateScore - abs(lines[i].score);
+            if(mateDistance < maxMateDistance){
+                snprintf(score, sizeof(score), "%s#%d", (lines[i].score > 0) ? "" : "-", (mateDistance + 1) / 2);
+            }
+            else{
+                snprintf(score, sizeof(score), "%+.2f", lines[i].score / 100.0);
+            }
+            string text;
+            activeGame.writeLine(lines[i].moves, &text);
+            cout << i + 1 << ". " << score << "  " << text << endl;
+        }
+        return 0;
+    }
+    
+    if(command == "--tournament"){
+        chessTournament tournament;
+        searchLimits candidate = {0, 1000}, baseline = {0, 1000};
+        for(int i = 2; i < argc; i++){
+            string option = argv[i];
+            if(option == "--games" && i + 1 < argc){
+                tournament.setMaxGames(atoi(argv[++i]));
+            }
+            else if(option == "--threads" && i + 1 < argc){
+                tournament.setThreadCount(atoi(argv[++i]));
+            }
+            else if(option == "--nodes" && i + 2 < argc){
+                candidate.nodes = strtoull(argv[++i], NULL, 10);
+                baseline.nodes = strtoull(argv[++i], NULL, 10);
+            }
+            else if(option == "--depth" && i + 2 < argc){
+                candidate.depth = atoi(argv[++i]);
+                baseline.depth = atoi(argv[++i]);
+            }
+            else if(option == "--sprt" && i + 2 < argc){
+                double elo0 = atof(argv[++i]);
+                double elo1 = atof(argv[++i]);
+                tournament.setSprt(elo0, elo1, 0.05, 0.05);
+            }
+            else if(option == "--openings" && i + 1 < argc){
+                if(!tournament.loadOpenings(argv[++i])){
+                    cout << "Could not read openings from " << argv[i] << endl;
+                    return 1;
+                }
+            }
+            else{
+                cout << "Unknown tournament option " << option << endl;
+                return 1;
+            }
+        }
+        if((candidate.depth == 0 && candidate.nodes == 0) || (baseline.depth == 0 && baseline.nodes == 0)){
+            cout << "Each player needs a depth or node limit" << endl;
+            return 1;
+        }
+        tournament.setPlayers(candidate, baseline);
+        auto start = chrono::steady_clock::now();
+        sprtVerdict verdict = tournament.run();
+        auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+        cout << "Match took " << elapsed.count() << " ms" << endl;
+        return (verdict == SPRT_REJECTED) ? 2 : 0;
+    }
+    
+    if(command == "--epd" && argc >= 3){
+        chessTestSuite suite;
+        searchLimits limits = {0, 200000};
+        bool isLimitSet = false;
+        int moveTime = 0;
+        for(int i = 3; i < argc; i++){
+            string option = argv[i];
+            if(option == "--nodes" && i + 1 < argc){
+                limits.nodes = strtoull(argv[++i], NULL, 10);
+                isLimitSet = true;
+            }
+            else if(option == "--depth" && i + 1 < argc){
+                limits.depth = atoi(argv[++i]);
+                isLimitSet = true;
+            }
+            else if(option == "--time" && i + 1 < argc){
+                moveTime = atoi(argv[++i]);
+            }
+            else if(option == "--threads" && i + 1 < argc){
+                suite.setThreadCount(atoi(argv[++i]));
+            }
+            else{
+                cout << "Unknown test suite option " << option << endl;
+                return 1;
+            }
+        }
+        // a move time replaces the default node limit, unless limits were given as well
+        if(moveTime > 0 && !isLimitSet){
+            limits = {0, 0};
+        }
+        if(limits.depth == 0 && limits.nodes == 0 && moveTime <= 0){
+            cout << "Each position needs a depth, node or time limit" << endl;
+            return 1;
+        }
+        if(!suite.loadSuite(argv[2])){
+            cout << "Could not read test positions from " << argv[2] << endl;
+            return 1;
+        }
+        suite.setBudget(limits, moveTime);
+        suite.run();
+        return 0;
+    }
+    
+    cout << "Usage: " << argv[0] << " --build-index <archive> <index>" << endl;
+    cout << "       " << argv[0] << " --find-position <index> [moves...]" << endl;
+    cout << "       " << argv[0] << " --export-san <archive>" << endl;
+    cout << "       " << argv[0] << " --resume <snapshot>" << endl;
+    cout << "       " << argv[0] << " --engine <white|black> [--nodes N] [--depth N] [--clock <seconds> <increment>] [--no-ponder]" << endl;
+    cout << "       " << argv[0] << " --perft <depth> [fen]" << endl;
+    cout << "       " << argv[0] << " --analyze <lines> <depth> [fen]" << endl;
+    cout << "       " << argv[0] << " --tournament [--games N] [--threads N] [--nodes candidate baseline]" << endl;
+    cout << "                [--depth candidate baseline] [--sprt elo0 elo1] [--openings file]" << endl;
+    cout << "       " << argv[0] << " --epd <file> [--nodes N] [--depth N] [--time ms] [--threads N]" << endl;
+    cout << "Add --stats to print performance counters when done, and put --events <fd|file> or" << endl;
+    cout << "--binary-events <fd|file> first to report the events of a game played from the menu," << endl;
+    cout << "--resume or --engine as JSON lines or binary records." << endl;
+    return 1;
+}
+
+/*
+ * 
+ */
+int main(int argc, char** argv) {
+    
+    // the event stream comes first, so it can be combined with the menu as well as with any command. Only the
+    // console game reports to it, the engine's self-play and test suite games are not events of that game
+    while(argc > 2 && (string(argv[1]) == "--events" || string(argv[1]) == "--binary-events")){
+        if(!eventStream.open(argv[2], (string(argv[1]) == "--events") ? EVENTS_JSON : EVENTS_BINARY)){
+            cout << "Could not open event stream " << argv[2] << endl;
+            return 1;
+        }
+        activeGame.setEventStream(&eventStream);
+        argv[2] = argv[0];
+        argv += 2;
+        argc -= 2;
+    }
+    
+    if(argc > 1){
+        bool dumpStats = (argc > 2 && string(argv[argc - 1]) == "--stats");
+        int result = runCommandLine(dumpStats ? argc - 1 : argc, argv);
+        if(dumpStats){
+            cerr << chessStats::toJson() << endl;
+        }
+        return result;
+    }
+    
+    int menuSelection;
+    string selection;
+    activeGame.setInputSource(&consoleInput);
+    do{
+    
+        
+    cout << "----------------------" << endl;    
+    cout << "||| 2 PLAYER CHESS |||" << endl;
+    cout << "----------------------" << endl;
+    cout << "       MAIN MENU      " << endl;
+    cout << "       ---------      " << endl;
+    cout << " Enter the number that" << endl;
+    cout << "matches the menu option" << endl;
+    cout << "       ---------      " << endl;
+    cout << "  1. Start New Game   " << endl;
+    cout << "  2. Program Tutorial " << endl;
+    cout << "  3. Software Info    " << endl;
+    cout << "  4. Exit Program     " << endl;
+    cout << "       ---------      " << endl;
+    cout << "Enter your selection: ";
+    cout.flush();
+    while(!consoleInput.pollLine(&selection, -1)){
+        if(consoleInput.isClosed()){
+            // input was closed, nothing more can be selected
+            return 0;
+        }
+    }
+    menuSelection = atoi(selection.c_str());
+    
+    switch(menuSelection){
+        case 1:
+            cout << "------------------------" << endl;
+            cout << "|||  Start New Game  |||" << endl;
+            cout << "------------------------" << endl;
+            activeGame.startNewGame();
+            activeGame.endGame();
+            break;
+        case 2:
+            cout << "------------------------" << endl;
+            cout << "||| Program Tutorial |||" << endl;
+            cout << "------------------------" << endl;
+            cout << "Select 'Start New Game' to begin." << endl;
+            cout << "Each player, starting with WHITE, will enter two pairs of coordinates:" << endl;
+            cout << "STARTING Coordinates: The position for the starting chess piece." << endl;
+            cout << "ENDING Coordinates: The desired destination for the chosen piece." << endl;
+            cout << "Moves are entered in the form of Standard Algebraic Notation (SAN)" << endl;
+            cout << "For example, bottom left corner of the board is A1, while top right corner of the board is H8" << endl;
+            cout << "The game ends when a player is in CHECKMATE, or the chess board becomes a STALEMATE" << endl;
+            cout << "Good luck!" << endl;
+            cout << "Returning to main menu..." << endl;
+            cout << "------------------------" << endl << endl;
+             break;
+        case 3:
+            cout << "------------------------" << endl;
+            cout << "|||   Software Info   |||" << endl;
+            cout << "------------------------" << endl;
+            cout << "This program was developed in C++ by Drew Tibbetts for COP2350C Section 01 Advanced C++ Programming" << endl;
+            cout << "Returning to main menu..." << endl;
+            cout << "------------------------" << endl << endl;
+            break;
+        case 4:
+            cout << "------------------------" << endl;
+            cout << "|||   Exit Program   |||" << endl;
+            cout << "------------------------" << endl;
+            cout << "Thank you for playing! Exiting program..." << endl;
+            cout << "------------------------" << endl << endl;
+            exit(0); 
+            break;
+        default:
+            cout << "------------------------" << endl;
+            cout <<"Please enter a valid menu selection between 1 and 4." << endl;
+            cout << "------------------------" << endl << endl;
+            break;  
+    }
+    }while(menuSelection != 4);       
+    
+    return 0;
+}
+
@@ -35,11 +35,32 @@ OBJECTDIR=${CND_BUILDDIR}/${CND_CONF}/${CND_PLATFORM}
 
 # Object Files
 OBJECTFILES= \
+	${OBJECTDIR}/chessArena.o \
+	${OBJECTDIR}/chessClock.o \
+	${OBJECTDIR}/chessEngine.o \
+	${OBJECTDIR}/chessEventStream.o \
 	${OBJECTDIR}/chessGame.o \
+	${OBJECTDIR}/chessHash.o \
+	${OBJECTDIR}/chessHint.o \
+	${OBJECTDIR}/chessHistory.o \
+	${OBJECTDIR}/chessIndex.o \
+	${OBJECTDIR}/chessInput.o \
 	${OBJECTDIR}/chessInterface.o \
 	${OBJECTDIR}/chessLogic.o \
+	${OBJECTDIR}/chessMoveLog.o \
+	${OBJECTDIR}/chessMovePicker.o \
+	${OBJECTDIR}/chessNotation.o \
+	${OBJECTDIR}/chessPawnTable.o \
 	${OBJECTDIR}/chessPiece.o \
+	${OBJECTDIR}/chessSearch.o \
+	${OBJECTDIR}/chessStats.o \
+	${OBJECTDIR}/chessTestSuite.o \
+	${OBJECTDIR}/chessThreadPool.o \
 	${OBJECTDIR}/chessTile.o \
+	${OBJECTDIR}/chessTimeManager.o \
+	${OBJECTDIR}/chessTournament.o \
+	${OBJECTDIR}/chessTrace.o \
+	${OBJECTDIR}/chessTransposition.o \
 	${OBJECTDIR}/main.o
 
 
@@ -57,7 +78,7 @@ FFLAGS=
 ASFLAGS=
 
 # Link Libraries and Options
-LDLIBSOPTIONS=
+LDLIBSOPTIONS=-pthread
 
 # Build Targets
 .build-conf: ${BUILD_SUBPROJECTS}
@@ -67,11 +88,56 @@ ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/2playerchess-finalv1.exe: ${OBJECTFIL
 	${MKDIR} -p ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}
 	${LINK.cc} -o ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/2playerchess-finalv1 ${OBJECTFILES} ${LDLIBSOPTIONS}
 
+${OBJECTDIR}/chessArena.o: chessArena.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessArena.o chessArena.cpp
+
+${OBJECTDIR}/chessClock.o: chessClock.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessClock.o chessClock.cpp
+
+${OBJECTDIR}/chessEngine.o: chessEngine.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessEngine.o chessEngine.cpp
+
+${OBJECTDIR}/chessEventStream.o: chessEventStream.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessEventStream.o chessEventStream.cpp
+
 ${OBJECTDIR}/chessGame.o: chessGame.cpp
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessGame.o chessGame.cpp
 
+${OBJECTDIR}/chessHash.o: chessHash.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessHash.o chessHash.cpp
+
+${OBJECTDIR}/chessHint.o: chessHint.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessHint.o chessHint.cpp
+
+${OBJECTDIR}/chessHistory.o: chessHistory.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessHistory.o chessHistory.cpp
+
+${OBJECTDIR}/chessIndex.o: chessIndex.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessIndex.o chessIndex.cpp
+
+${OBJECTDIR}/chessInput.o: chessInput.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessInput.o chessInput.cpp
+
 ${OBJECTDIR}/chessInterface.o: chessInterface.cpp
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
@@ -82,16 +148,76 @@ ${OBJECTDIR}/chessLogic.o: chessLogic.cpp
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessLogic.o chessLogic.cpp
 
+${OBJECTDIR}/chessMoveLog.o: chessMoveLog.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessMoveLog.o chessMoveLog.cpp
+
+${OBJECTDIR}/chessMovePicker.o: chessMovePicker.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessMovePicker.o chessMovePicker.cpp
+
+${OBJECTDIR}/chessNotation.o: chessNotation.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessNotation.o chessNotation.cpp
+
+${OBJECTDIR}/chessPawnTable.o: chessPawnTable.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessPawnTable.o chessPawnTable.cpp
+
 ${OBJECTDIR}/chessPiece.o: chessPiece.cpp
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessPiece.o chessPiece.cpp
 
+${OBJECTDIR}/chessSearch.o: chessSearch.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessSearch.o chessSearch.cpp
+
+${OBJECTDIR}/chessStats.o: chessStats.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessStats.o chessStats.cpp
+
+${OBJECTDIR}/chessTestSuite.o: chessTestSuite.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessTestSuite.o chessTestSuite.cpp
+
+${OBJECTDIR}/chessThreadPool.o: chessThreadPool.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessThreadPool.o chessThreadPool.cpp
+
 ${OBJECTDIR}/chessTile.o: chessTile.cpp
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessTile.o chessTile.cpp
 
+${OBJECTDIR}/chessTimeManager.o: chessTimeManager.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessTimeManager.o chessTimeManager.cpp
+
+${OBJECTDIR}/chessTournament.o: chessTournament.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessTournament.o chessTournament.cpp
+
+${OBJECTDIR}/chessTrace.o: chessTrace.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessTrace.o chessTrace.cpp
+
+${OBJECTDIR}/chessTransposition.o: chessTransposition.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/chessTransposition.o chessTransposition.cpp
+
 ${OBJECTDIR}/main.o: main.cpp
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
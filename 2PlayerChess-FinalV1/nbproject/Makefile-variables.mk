@@ -22,6 +22,14 @@ CND_ARTIFACT_PATH_Release=dist/Release/Cygwin-Windows/2playerchess-finalv1
 CND_PACKAGE_DIR_Release=dist/Release/Cygwin-Windows/package
 CND_PACKAGE_NAME_Release=2playerchess-finalv1.tar
 CND_PACKAGE_PATH_Release=dist/Release/Cygwin-Windows/package/2playerchess-finalv1.tar
+# Benchmark configuration
+CND_PLATFORM_Benchmark=Cygwin-Windows
+CND_ARTIFACT_DIR_Benchmark=dist/Benchmark/Cygwin-Windows
+CND_ARTIFACT_NAME_Benchmark=2playerchess-benchmark
+CND_ARTIFACT_PATH_Benchmark=dist/Benchmark/Cygwin-Windows/2playerchess-benchmark
+CND_PACKAGE_DIR_Benchmark=dist/Benchmark/Cygwin-Windows/package
+CND_PACKAGE_NAME_Benchmark=2playerchess-benchmark.tar
+CND_PACKAGE_PATH_Benchmark=dist/Benchmark/Cygwin-Windows/package/2playerchess-benchmark.tar
 #
 # include compiler specific variables
 #